@@ -31,6 +31,92 @@ typedef Arry<double> DArry;
 /** \brief Alias of std::vector<std::complex<double>>. */
 typedef Arry<Cmplx> CArry;
 
+/** \brief Alias of std::vector<float>. */
+typedef Arry<float> FArry;
+
+/** \brief Alias of std::vector<long double>. */
+typedef Arry<long double> LArry;
+
+/** \brief Engines finding all roots of a polynomial. */
+enum RootMethod: int { ABERTH=0, COMPANION };
+
+/** \brief Accuracy of evaluations: plain or compensated Horner's scheme. */
+enum Accuracy: int { STANDARD=0, COMPENSATED };
+
+/** \brief Per-polynomial outcomes of batched root finding. */
+enum RootStatus: int { CONVERGED=0, NOT_CONVERGED, BAD_COEFFS };
+
+/** \brief Wall-clock seconds spent in each phase of yan_and_chieng_2006. */
+struct PhaseTimings
+{
+    double gcd = 0.0; ///< f' and GCD(f, f')
+    double quotient = 0.0; ///< f / GCD and f' / GCD
+    double simple = 0.0; ///< simple roots of f / GCD
+    double multiplicity = 0.0; ///< multiplicities of the simple roots
+    double refine = 0.0; ///< refinement of simple roots on f
+    double select = 0.0; ///< choice between unrefined and refined roots
+
+    /** \brief Total seconds. */
+    double total() const
+    { return gcd + quotient + simple + multiplicity + refine + select; }
+};
+
+/**
+ * \brief Statistics of root-finding functions.
+ *
+ * Root finders fill the RootStats registered on the calling thread through a
+ * RootStatsScope. Collection only happens when the library is configured with
+ * the CMake option SIMPOLY_ROOT_STATS; otherwise the instrumentation compiles
+ * to nothing and the statistics stay zero (see root_stats_enabled()).
+ */
+struct RootStats
+{
+    unsigned long evaluations = 0; ///< Horner passes over f, f', or f/GCD
+    unsigned long iterations = 0; ///< iterations of all Newton/Aberth loops
+    std::vector<unsigned> sweeps; ///< per-root convergence sweep of the last Aberth run
+    unsigned gcd_steps = 0; ///< remainder-sequence length of the last GCD
+    double limit_ratio = 0.0; ///< largest iteration count / InfLoop limit of any loop
+    PhaseTimings timings; ///< phases of the last yan_and_chieng_2006
+
+    /** \brief Whether some loop used more than half of its InfLoop limit. */
+    bool near_limit() const { return limit_ratio > 0.5; }
+};
+
+/**
+ * \brief Register a RootStats to be filled on this thread within a scope.
+ *
+ * Scopes nest; the innermost one receives the statistics, and the previous
+ * one is restored on destruction.
+ */
+class RootStatsScope
+{
+public:
+
+    /**
+     * \brief Constructor.
+     *
+     * \param stats [in, out] The statistics to fill.
+     */
+    explicit RootStatsScope(RootStats &stats);
+
+    /** \brief Destructor. */
+    ~RootStatsScope();
+
+    RootStatsScope(const RootStatsScope &) = delete;
+    RootStatsScope &operator=(const RootStatsScope &) = delete;
+
+private:
+
+    RootStats *_prev; ///< the scope that was active before this one
+};
+
+/**
+ * \brief Whether the library was built with SIMPOLY_ROOT_STATS.
+ *
+ * \return True if root finders collect statistics.
+ */
+bool root_stats_enabled();
+
 /**
  * \brief Convert a DArry to CArry.
  *
@@ -256,6 +342,14 @@ Arry<T> divide(const Arry<T> &p, const T &c);
 /**
  * \brief Find greatest common divisor of two polynomials.
  *
+ * Euclid's remainder sequence runs in place on one preallocated buffer; it
+ * stops once the relative norm of a remainder drops below `tol`. For divisors
+ * of degree above 2048, a half GCD with FFT products jumps over half of the
+ * remaining sequence at a time. It only takes steps whose remainders keep a
+ * relative leading coefficient of at least sqrt(tol) and whose products show
+ * cancellation errors below that; elsewhere the step-wise sequence takes
+ * over, so that the `tol` test is always made step by step.
+ *
  * \tparam T Base type of the entries in coefficient array.
  * \param p1 [in] A std::vector representing the first polynomial.
  * \param p2 [in] A std::vector representing the second polynomial.
@@ -266,6 +360,62 @@ Arry<T> divide(const Arry<T> &p, const T &c);
 template <typename T>
 Arry<T> GCD(const Arry<T> &p1, const Arry<T> &p2, const double tol=1e-8);
 
+/**
+ * \brief In-place synthetic division by (x - r).
+ *
+ * The quotient replaces p, so p loses one coefficient and nothing is
+ * allocated. Dividing a constant gives the zero polynomial.
+ *
+ * \tparam T Basic type of each entry in the std::vector.
+ * \param p [in, out] Coefficients of the polynomial; the quotient on return.
+ * \param r [in] The root of the linear factor.
+ *
+ * \return The remainder, i.e., p(r).
+ */
+template <typename T>
+T synthetic_division(Arry<T> &p, const T &r);
+
+/**
+ * \brief In-place synthetic division by (x^2 + b x + c).
+ *
+ * \tparam T Basic type of each entry in the std::vector.
+ * \param p [in, out] Coefficients of the polynomial; the quotient on return.
+ * \param b [in] Coefficient of x in the quadratic factor.
+ * \param c [in] Constant term of the quadratic factor.
+ * \param r1 [out] Coefficient of x in the remainder.
+ * \param r0 [out] Constant term of the remainder.
+ */
+template <typename T>
+void synthetic_division(Arry<T> &p, const T &b, const T &c, T &r1, T &r0);
+
+/**
+ * \brief Deflate many roots in one sweep over the coefficients.
+ *
+ * The linear factors are chained so that each consumes the quotient of the
+ * previous one as soon as it is produced; the cost is O(n m) for m roots with
+ * no intermediate polynomials. Roots are deflated in ascending modulus, which
+ * keeps forward deflation stable. Remainders are discarded, i.e., the roots
+ * are assumed to be roots of p.
+ *
+ * \tparam T Basic type of each entry in the std::vector.
+ * \param p [in, out] Coefficients of the polynomial; the quotient on return.
+ * \param roots [in] Roots to remove, repeated by multiplicities.
+ */
+template <typename T>
+void deflate(Arry<T> &p, const Arry<T> &roots);
+
+/**
+ * \brief Deflate real roots and complex-conjugate pairs in one sweep.
+ *
+ * Each pair z, conj(z) in `croots` is removed as the real quadratic factor
+ * x^2 - 2 Re(z) x + |z|^2, so the arithmetic stays real.
+ *
+ * \param p [in, out] Coefficients of the polynomial; the quotient on return.
+ * \param rroots [in] Real roots to remove.
+ * \param croots [in] Complex roots to remove; both members of each pair.
+ */
+void deflate(DArry &p, const DArry &rroots, const CArry &croots);
+
 
 /**
  * \brief Evaluate polynomial value at a specified location.
@@ -299,6 +449,52 @@ T evaluate(const T* const &bg, const int len, const T x);
 template <typename T>
 T evaluate(const Arry<T> &coeffs, const T x);
 
+/**
+ * \brief Evaluate polynomial value and its derivative at a specified location.
+ *
+ * Both values come from a single Horner pass over the coefficient array.
+ *
+ * \tparam T Basic type of each entry in the std::vector.
+ * \param coeffs [in] A std::vector representing polynomial coefficients.
+ * \param x [in] The specified location.
+ * \param d [out] Value of the derivative at x.
+ *
+ * \return Polynomial value.
+ */
+template <typename T>
+T evaluate_with_derivative(const Arry<T> &coeffs, const T x, T &d);
+
+/**
+ * \brief Evaluate polynomial value with the compensated Horner's scheme.
+ *
+ * Rounding errors of every Horner step are captured exactly with error-free
+ * transformations (TwoSum and TwoProd) and accumulated in a second Horner
+ * pass, so the result is as accurate as Horner's scheme in twice the working
+ * precision, rounded back to working precision (Graillat, Langlois & Louvet,
+ * 2005). The cost is about 2-4 times that of plain Horner's scheme.
+ *
+ * \tparam T Basic type of each entry in the std::vector.
+ * \param coeffs [in] A std::vector representing polynomial coefficients.
+ * \param x [in] The specified location.
+ *
+ * \return Polynomial value.
+ */
+template <typename T>
+T evaluate_compensated(const Arry<T> &coeffs, const T x);
+
+/**
+ * \brief Evaluate polynomial value with a given accuracy.
+ *
+ * \tparam T Basic type of each entry in the std::vector.
+ * \param coeffs [in] A std::vector representing polynomial coefficients.
+ * \param x [in] The specified location.
+ * \param accuracy [in] STANDARD or COMPENSATED Horner's scheme.
+ *
+ * \return Polynomial value.
+ */
+template <typename T>
+T evaluate(const Arry<T> &coeffs, const T x, const Accuracy accuracy);
+
 /**
  * \brief Evaluate polynomial value at a specified location by providing roots.
  *
@@ -356,6 +552,107 @@ template <typename T>
 Arry<T> integral(const Arry<T> &coeffs);
 
 
+/**
+ * \brief Taylor shift in place: coefficients of p(x + a).
+ *
+ * Horner's scheme applied repeatedly, i.e., synthetic division by (x - a)
+ * n times, in n(n+1)/2 multiply-adds and no allocation.
+ *
+ * \tparam T Basic type of each entry in the coefficient array.
+ * \param c [in, out] Pointer to the len coefficients of p; those of
+ *        p(x + a) on return.
+ * \param len [in] The length of coefficient array.
+ * \param a [in] The shift.
+ */
+template <typename T>
+void taylor_shift(T *c, const unsigned len, const T &a);
+
+/**
+ * \brief Taylor shift: coefficients of p(x + a), in O(n^2).
+ *
+ * \tparam T Basic type of each entry in the std::vector.
+ * \param coeffs [in] A polynomial defined by std::vector.
+ * \param a [in] The shift.
+ *
+ * \return Coefficients of p(x + a).
+ */
+template <typename T>
+Arry<T> taylor_shift(const Arry<T> &coeffs, const T &a);
+
+/**
+ * \brief Taylor shift of one polynomial to many centers, in O(n^2) each.
+ *
+ * All centers are shifted together, so the inner loop runs across centers
+ * with unit stride.
+ *
+ * \param coeffs [in] A polynomial p defined by std::vector, of length n + 1.
+ * \param m [in] Number of centers.
+ * \param a [in] m shifts.
+ * \param out [out] m * (n + 1) coefficients; block q holds p(x + a[q]).
+ */
+void taylor_shift(const DArry &coeffs, const unsigned m, const double *a, double *out);
+
+/**
+ * \brief Taylor shift with fast multiplication: coefficients of p(x + a).
+ *
+ * Divide and conquer: with p = p_lo + x^h p_hi, h a power of two,
+ * p(x + a) = p_lo(x + a) + (x + a)^h p_hi(x + a), where the binomial powers
+ * (x + a)^h are formed directly and large products use the FFT. The cost is
+ * O(n log^2 n), against O(n^2) for Horner's scheme, and it pays off from
+ * degrees of about a hundred.
+ *
+ * \param coeffs [in] A polynomial defined by std::vector.
+ * \param a [in] The shift.
+ *
+ * \return Coefficients of p(x + a).
+ */
+DArry taylor_shift_fast(const DArry &coeffs, const double a);
+
+/**
+ * \brief Composition with an affine map: coefficients of p(s x + t).
+ *
+ * A Taylor shift by t followed by scaling coefficient k by s^k. Mapping a
+ * polynomial on [-1, 1] to [a, b] uses s = 2 / (b - a) and
+ * t = -(a + b) / (b - a).
+ *
+ * \tparam T Basic type of each entry in the std::vector.
+ * \param coeffs [in] A polynomial defined by std::vector.
+ * \param s [in] The scale.
+ * \param t [in] The shift.
+ *
+ * \return Coefficients of p(s x + t).
+ */
+template <typename T>
+Arry<T> compose_affine(const Arry<T> &coeffs, const T &s, const T &t);
+
+/**
+ * \brief Composition of two polynomials: coefficients of p(q(x)).
+ *
+ * Baby-step giant-step: with k about sqrt(n + 1), p is split into blocks of
+ * k coefficients, p = sum_i P_i(x) x^(ik). Each P_i(q) is a linear
+ * combination of the baby steps q^0, ..., q^(k-1), and the blocks are
+ * combined by divide and conquer with the giant steps (q^k)^(2^j), so all
+ * large products go through the FFT. Results are accumulated in place into
+ * the output; only the halves of the divide and conquer need work space.
+ * Outer polynomials of low degree use Horner's scheme in place instead.
+ *
+ * \param p [in] The outer polynomial, of degree n.
+ * \param q [in] The inner polynomial, of degree m.
+ * \param out [out] n * m + 1 coefficients of p(q(x)).
+ */
+void compose(const DArry &p, const DArry &q, double *out);
+
+/**
+ * \brief Composition of two polynomials: coefficients of p(q(x)).
+ *
+ * \param p [in] The outer polynomial, of degree n.
+ * \param q [in] The inner polynomial, of degree m.
+ *
+ * \return n * m + 1 coefficients of p(q(x)).
+ */
+DArry compose(const DArry &p, const DArry &q);
+
+
 /**
  * \brief Basic Newton-Raphson root-finding method.
  *
@@ -367,11 +664,97 @@ Arry<T> integral(const Arry<T> &coeffs);
  * \param coeffs [in] A std::vector representing polynomial coefficients.
  * \param guess [in] An initial guess.
  * \param tol [in] Tolerance that mimics zero.
+ * \param accuracy [in] With COMPENSATED, residuals come from the compensated
+ *        Horner's scheme and the root is polished after convergence.
  *
  * \return Root.
  */
 template <typename T>
-T newton_raphson(const Arry<T> &coeffs, const T guess, const double tol=1e-13);
+T newton_raphson(const Arry<T> &coeffs, const T guess, const double tol=1e-13,
+        const Accuracy accuracy=Accuracy::STANDARD);
+
+/**
+ * \brief Polish a simple root with Newton steps on compensated residuals.
+ *
+ * Residuals from the compensated Horner's scheme are accurate even where
+ * plain Horner's scheme only returns rounding noise, so the root becomes as
+ * accurate as if computed in twice the working precision (Graillat, 2008).
+ * Steps are taken while the compensated residual decreases.
+ *
+ * \tparam T The basic data type of the coefficient array.
+ * \param coeffs [in] A std::vector representing polynomial coefficients.
+ * \param x [in] An approximation of a simple root.
+ * \param max_steps [in] Maximum number of Newton steps (default: 3).
+ *
+ * \return The polished root.
+ */
+template <typename T>
+T polish(const Arry<T> &coeffs, const T x, const unsigned max_steps=3);
+
+/**
+ * \brief Polish roots with Newton steps on compensated residuals.
+ *
+ * Consecutive identical copies of a multiple root, as returned by
+ * yan_and_chieng_2006, are left untouched.
+ *
+ * \param coeffs [in] A std::vector representing polynomial coefficients.
+ * \param roots [in, out] Roots to polish.
+ * \param max_steps [in] Maximum number of Newton steps per root (default: 3).
+ */
+void polish(const CArry &coeffs, CArry &roots, const unsigned max_steps=3);
+
+/**
+ * \brief Polish roots with Newton steps on compensated residuals.
+ *
+ * Overloaded version that accepts std::vector<double>.
+ *
+ * \param coeffs [in] A std::vector representing polynomial coefficients.
+ * \param roots [in, out] Roots to polish.
+ * \param max_steps [in] Maximum number of Newton steps per root (default: 3).
+ */
+void polish(const DArry &coeffs, CArry &roots, const unsigned max_steps=3);
+
+/**
+ * \brief Initial guess of all roots from the Newton polygon.
+ *
+ * This follows Bini (1996). The upper convex hull of the points
+ * (i, log|a_i|) gives estimates of the root moduli: an edge from vertex k to
+ * vertex m suggests m-k roots of modulus (|a_k| / |a_m|)^(1/(m-k)). The
+ * guesses are placed evenly on circles of these radii, with a rotation
+ * between circles so that no guess lies on the real axis. If a_0 = ... =
+ * a_{k-1} = 0, the k roots at the origin are seeded on a tiny circle.
+ *
+ * \param coeffs [in] A std::vector representing polynomial coefficients.
+ *
+ * \return A std::vector of initial guesses.
+ */
+CArry initial_guess(const CArry &coeffs);
+
+/**
+ * \brief Initial guess of all roots from the Newton polygon.
+ *
+ * Overloaded version that accepts std::vector<double>.
+ *
+ * \param coeffs [in] A std::vector representing polynomial coefficients.
+ *
+ * \return A std::vector of initial guesses.
+ */
+CArry initial_guess(const DArry &coeffs);
+
+/**
+ * \brief Initial guess of all roots from the Newton polygon.
+ *
+ * Overloaded version on raw arrays that allocates nothing.
+ *
+ * \param len [in] Length of the coefficient array (degree + 1).
+ * \param mag [in] Moduli of the coefficients, |a_0| ... |a_n|; |a_n| > 0.
+ * \param zr [out] Real parts of the len-1 guesses.
+ * \param zi [out] Imaginary parts of the len-1 guesses.
+ * \param lg [in] Work space of at least len doubles.
+ * \param iwork [in] Work space of at least 2*len unsigned integers.
+ */
+void initial_guess(const unsigned len, const double *mag,
+        double *zr, double *zi, double *lg, unsigned *iwork);
 
 /**
  * \brief Aberth method for root finding.
@@ -390,6 +773,26 @@ T newton_raphson(const Arry<T> &coeffs, const T guess, const double tol=1e-13);
  */
 CArry aberth(const CArry &coeffs, const CArry &guess, const double tol=1e-10);
 
+/**
+ * \brief Aberth method for root finding with per-root iteration counts.
+ *
+ * This is the underlying implementation of all `aberth` overloads. Roots are
+ * updated one by one with the newest values (Gauss-Seidel style). Once a root
+ * converges, it is frozen: it still contributes to the pairwise sums of other
+ * roots, but it is no longer evaluated or updated. The indices of roots still
+ * iterating are compacted after every sweep, so the cost of a sweep shrinks as
+ * roots converge.
+ *
+ * \param coeffs [in] A std::vector representing polynomial coefficients.
+ * \param guess [in] A std::vector of initial guess to all roots.
+ * \param iters [out] The number of sweeps each root took to converge.
+ * \param tol [in] Tolerance that mimics zero.
+ *
+ * \return A std::vector of all roots.
+ */
+CArry aberth(const CArry &coeffs, const CArry &guess,
+        std::vector<unsigned> &iters, const double tol=1e-10);
+
 /**
  * \brief Aberth method for root finding.
  *
@@ -436,8 +839,8 @@ CArry aberth(const DArry &coeffs, const DArry &guess, const double tol=1e-10);
 /**
  * \brief Aberth method for root finding.
  *
- * An overloaded version of Aberth method that uses default initial guess,
- * instead of user-provided initial guess.
+ * An overloaded version of Aberth method that uses default initial guess
+ * from `initial_guess`, instead of user-provided initial guess.
  *
  * \param coeffs [in] A std::vector representing polynomial coefficients.
  * \param tol [in] Tolerance that mimics zero.
@@ -449,8 +852,9 @@ CArry aberth(const CArry &coeffs, const double tol=1e-10);
 /**
  * \brief Aberth method for root finding.
  *
- * An overloaded version of Aberth method that uses default initial guess,
- * instead of user-provided initial guess. Also, the coefficient array is a
+ * An overloaded version of Aberth method that uses default initial guess
+ * from `initial_guess`, instead of user-provided initial guess. Also, the
+ * coefficient array is a
  * std::vector of real numbers, not complex numbers.
  *
  * \param coeffs [in] A std::vector representing polynomial coefficients.
@@ -460,18 +864,249 @@ CArry aberth(const CArry &coeffs, const double tol=1e-10);
  */
 CArry aberth(const DArry &coeffs, const double tol=1e-10);
 
+/**
+ * \brief Simultaneous (Jacobi-style) Aberth iteration on split arrays.
+ *
+ * Unlike `aberth`, which updates roots one by one with the newest values
+ * (Gauss-Seidel style), every sweep here computes all corrections from the
+ * roots of the previous sweep and then updates them together. Roots and
+ * coefficients are stored as separate real and imaginary arrays, so the
+ * O(n^2) pairwise sums run over contiguous doubles and vectorize. The
+ * corrections of different roots are independent, so they can be split over
+ * threads; this pays off for degrees of several hundred and higher. A root
+ * stops once its correction is below `tol` relatively, or once p(z) is at the
+ * rounding level of Horner's scheme. Corrections are formed from the ratio
+ * p(z) / p'(z), evaluated through z^n p(1/z) outside the unit disk, so neither
+ * overflows at high degrees. A correction that is still not finite fails its
+ * root, which keeps its last iterate and gets the flag -1 in the last n
+ * entries of `work`; this throws `PolynomialErrorGeneral`.
+ *
+ * \param len [in] Length of the coefficient arrays (degree + 1).
+ * \param cr [in] Real parts of the coefficients.
+ * \param ci [in] Imaginary parts of the coefficients.
+ * \param zr [in, out] Real parts of the initial guess / roots (len-1 entries).
+ * \param zi [in, out] Imaginary parts of the initial guess / roots.
+ * \param work [in] Work space of at least 3*(len-1) doubles.
+ * \param tol [in] Tolerance that mimics zero.
+ * \param nthreads [in] Number of threads.
+ *
+ * \return The number of sweeps.
+ */
+unsigned aberth_simultaneous(const unsigned len,
+        const double *cr, const double *ci, double *zr, double *zi,
+        double *work, const double tol, const unsigned nthreads);
+
+/**
+ * \brief Simultaneous (Jacobi-style) Aberth iteration.
+ *
+ * See the raw-array version for details.
+ *
+ * \param coeffs [in] A std::vector representing polynomial coefficients.
+ * \param guess [in] A std::vector of initial guess to all roots.
+ * \param tol [in] Tolerance that mimics zero.
+ * \param nthreads [in] Number of threads (default: 1).
+ *
+ * \return A std::vector of all roots.
+ */
+CArry aberth_simultaneous(const CArry &coeffs, const CArry &guess,
+        const double tol=1e-10, const unsigned nthreads=1);
+
+/**
+ * \brief Simultaneous (Jacobi-style) Aberth iteration.
+ *
+ * An overloaded version that provided coefficients is a std::vector of
+ * real numbers.
+ *
+ * \param coeffs [in] A std::vector representing polynomial coefficients.
+ * \param guess [in] A std::vector of initial guess to all roots.
+ * \param tol [in] Tolerance that mimics zero.
+ * \param nthreads [in] Number of threads (default: 1).
+ *
+ * \return A std::vector of all roots.
+ */
+CArry aberth_simultaneous(const DArry &coeffs, const CArry &guess,
+        const double tol=1e-10, const unsigned nthreads=1);
+
+/**
+ * \brief Simultaneous (Jacobi-style) Aberth iteration.
+ *
+ * An overloaded version that uses the default initial guess from
+ * `initial_guess`.
+ *
+ * \param coeffs [in] A std::vector representing polynomial coefficients.
+ * \param tol [in] Tolerance that mimics zero.
+ * \param nthreads [in] Number of threads (default: 1).
+ *
+ * \return A std::vector of all roots.
+ */
+CArry aberth_simultaneous(const CArry &coeffs,
+        const double tol=1e-10, const unsigned nthreads=1);
+
+/**
+ * \brief Simultaneous (Jacobi-style) Aberth iteration.
+ *
+ * An overloaded version that uses the default initial guess from
+ * `initial_guess` and accepts a std::vector of real coefficients.
+ *
+ * \param coeffs [in] A std::vector representing polynomial coefficients.
+ * \param tol [in] Tolerance that mimics zero.
+ * \param nthreads [in] Number of threads (default: 1).
+ *
+ * \return A std::vector of all roots.
+ */
+CArry aberth_simultaneous(const DArry &coeffs,
+        const double tol=1e-10, const unsigned nthreads=1);
+
+/**
+ * \brief Roots of many real polynomials of the same degree.
+ *
+ * Polynomials are taken from a contiguous block with a fixed stride and are
+ * distributed over threads in small chunks taken from a shared counter, so
+ * that uneven convergence does not leave threads idle. Each thread owns one
+ * scratch arena for the whole call; nothing is allocated per polynomial.
+ * Cubics and quartics use closed forms (see `cubic_roots` and
+ * `quartic_roots`); other degrees use the Newton-polygon initial guess and
+ * simultaneous Aberth sweeps. Multiplicities are not detected: multiple roots
+ * converge slowly and may end as NOT_CONVERGED.
+ *
+ * Failures never throw; they are reported per polynomial in `status`. Roots of
+ * polynomials with a zero leading coefficient or non-finite coefficients are
+ * set to NaN (BAD_COEFFS); roots of NOT_CONVERGED polynomials hold the last
+ * finite iterates, as a correction that is not finite stops the iteration
+ * (see `aberth_simultaneous`) and is never applied.
+ *
+ * \param N [in] Number of polynomials.
+ * \param len [in] Number of coefficients of each polynomial (degree + 1).
+ * \param coeffs [in] Coefficients; coeffs[i*stride+k] is the coefficient of
+ *        x^k of the i-th polynomial.
+ * \param stride [in] Distance between the first coefficients of consecutive
+ *        polynomials; stride >= len.
+ * \param re [out] N*(len-1) real parts; re[i*(len-1)+j] is the j-th root of
+ *        the i-th polynomial.
+ * \param im [out] N*(len-1) imaginary parts in the same layout.
+ * \param status [out] N RootStatus values.
+ * \param tol [in] Tolerance that mimics zero (default: 1e-10).
+ * \param nthreads [in] Number of threads (default: 1).
+ * \param max_sweeps [in] Maximum number of Aberth sweeps (default: 1000).
+ */
+void batch_roots(const unsigned N, const unsigned len, const double *coeffs,
+        const unsigned stride, double *re, double *im, int *status,
+        const double tol=1e-10, const unsigned nthreads=1,
+        const unsigned max_sweeps=1000);
+
+/**
+ * \brief Roots as eigenvalues of the companion matrix.
+ *
+ * The companion matrix of the monic polynomial is kept as a unitary matrix
+ * times an upper-triangular unitary-plus-rank-one matrix, both stored as
+ * sequences of 2 x 2 rotations, and reduced with single-shift (Wilkinson) QR
+ * sweeps that only operate on those rotations (Aurentz, Mach, Vandebril and
+ * Watkins, 2015). No initial guess is needed, and the result does not depend
+ * on one. It costs O(n^2) time and O(n) memory.
+ *
+ * The factored form can not be balanced, and the sweeps are only backward
+ * stable relative to the norm of the coefficients. Instead, x is scaled by a
+ * power of two near the geometric mean of the root moduli, subdiagonal
+ * entries are deflated relative to their diagonal neighbours, and the
+ * eigenvalues get a few Aberth corrections with compensated residuals on the
+ * original coefficients (each kept only if it lowers the residual), which
+ * recovers roots of badly scaled polynomials such as Wilkinson's.
+ *
+ * \param coeffs [in] A std::vector representing polynomial coefficients.
+ *
+ * \return A std::vector of all roots.
+ */
+CArry companion_roots(const CArry &coeffs);
+
+/**
+ * \brief Roots as eigenvalues of the companion matrix.
+ *
+ * Overloaded version that accepts std::vector<double>.
+ *
+ * \param coeffs [in] A std::vector representing polynomial coefficients.
+ *
+ * \return A std::vector of all roots.
+ */
+CArry companion_roots(const DArry &coeffs);
+
+/**
+ * \brief Roots of many real cubics at once.
+ *
+ * Closed-form solutions (trigonometric form for three real roots, Cardano's
+ * formula otherwise) followed by one Newton step. Polynomials are stored in
+ * structure-of-arrays layout so that loops run across polynomials. Leading
+ * coefficients must be nonzero.
+ *
+ * \param N [in] Number of polynomials.
+ * \param coeffs [in] 4*N coefficients; coeffs[k*N+i] is the coefficient of
+ *        x^k of the i-th polynomial.
+ * \param re [out] 3*N real parts; re[j*N+i] belongs to the j-th root of the
+ *        i-th polynomial. The 0-th root is always real.
+ * \param im [out] 3*N imaginary parts in the same layout.
+ */
+void cubic_roots(const unsigned N, const double *coeffs, double *re, double *im);
+
+/**
+ * \brief Roots of many real quartics at once.
+ *
+ * Ferrari's method with the largest real root of the resolvent cubic,
+ * followed by one Newton step on real roots. The layout is the same as
+ * `cubic_roots`.
+ *
+ * \param N [in] Number of polynomials.
+ * \param coeffs [in] 5*N coefficients; coeffs[k*N+i] is the coefficient of
+ *        x^k of the i-th polynomial.
+ * \param re [out] 4*N real parts; re[j*N+i] belongs to the j-th root of the
+ *        i-th polynomial.
+ * \param im [out] 4*N imaginary parts in the same layout.
+ */
+void quartic_roots(const unsigned N, const double *coeffs, double *re, double *im);
+
+/**
+ * \brief Real roots of a polynomial in a closed interval.
+ *
+ * The polynomial is mapped to [0, 1] and written in the Bernstein basis,
+ * where the number of sign variations of coefficients bounds the number of
+ * roots (Descartes' rule of signs). Intervals are bisected with de Casteljau's
+ * algorithm until each one holds at most one root, which is then refined with
+ * safeguarded Newton-bisection. Only real arithmetic is used. The Bernstein
+ * coefficients are computed in double-double arithmetic, and each carries a
+ * bound of its rounding error that decides which signs are trusted.
+ *
+ * An end point is a root if |p| there, evaluated with the compensated Horner's
+ * scheme, is at most eps times the sum of |a_k x^k|; its factor is then divided
+ * out of the Bernstein coefficients. Roots that can not be separated at the
+ * rounding level of the coefficients (e.g., multiple roots) are reported once.
+ *
+ * \param coeffs [in] A std::vector representing polynomial coefficients.
+ * \param a [in] Left end of the interval.
+ * \param b [in] Right end of the interval; requires a < b.
+ * \param tol [in] Tolerance of roots (default: 1e-12).
+ *
+ * \return Sorted real roots in [a, b].
+ */
+DArry real_roots_in(const DArry &coeffs, const double a, const double b,
+        const double tol=1e-12);
+
 /**
  * \brief Root-finding function that implements method from Yan & Chieng (2006)
  *
  * The method proposed by Yan & Chieng can handle roots with multiplicities
- * greater than 1.
+ * greater than 1. Simple roots of f/GCD(f, f') come from the engine `method`,
+ * and they are then refined with Aberth iterations on f. Intermediate
+ * polynomials share one scratch array, each root is evaluated with fused
+ * value-and-derivative Horner passes, and the refinement runs Jacobi-style
+ * sweeps whose corrections are computed on `nthreads` threads.
  *
  * \param coeffs [in] A std::vector representing polynomial coefficients.
  * \param tol [in] Tolerance that mimics zero.
+ * \param method [in] Engine finding simple roots (default: ABERTH).
+ * \param nthreads [in] Number of threads for the refinement (default: 1).
  *
  * \return A std::vector of all roots.
  */
-CArry yan_and_chieng_2006(const CArry &coeffs, const double tol=1e-10);
+CArry yan_and_chieng_2006(const CArry &coeffs, const double tol=1e-10,
+        const RootMethod method=RootMethod::ABERTH, const unsigned nthreads=1);
 
 /**
  * \brief Root-finding function that implements method from Yan & Chieng (2006)
@@ -480,11 +1115,45 @@ CArry yan_and_chieng_2006(const CArry &coeffs, const double tol=1e-10);
  *
  * \param coeffs [in] A std::vector representing polynomial coefficients.
  * \param tol [in] Tolerance that mimics zero.
+ * \param method [in] Engine finding simple roots (default: ABERTH).
+ * \param nthreads [in] Number of threads for the refinement (default: 1).
  *
  * \return A std::vector of all roots.
  */
-CArry yan_and_chieng_2006(const DArry &coeffs, const double tol=1e-10);
+CArry yan_and_chieng_2006(const DArry &coeffs, const double tol=1e-10,
+        const RootMethod method=RootMethod::ABERTH, const unsigned nthreads=1);
 
+/**
+ * \brief Method of Yan & Chieng (2006) that also reports time of each phase.
+ *
+ * \param coeffs [in] A std::vector representing polynomial coefficients.
+ * \param timings [out] Wall-clock seconds spent in each phase.
+ * \param tol [in] Tolerance that mimics zero.
+ * \param method [in] Engine finding simple roots (default: ABERTH).
+ * \param nthreads [in] Number of threads for the refinement (default: 1).
+ *
+ * \return A std::vector of all roots.
+ */
+CArry yan_and_chieng_2006(const CArry &coeffs, PhaseTimings &timings,
+        const double tol=1e-10, const RootMethod method=RootMethod::ABERTH,
+        const unsigned nthreads=1);
+
+/**
+ * \brief Method of Yan & Chieng (2006) that also reports time of each phase.
+ *
+ * Overloaded version the accepts std::vector<double>.
+ *
+ * \param coeffs [in] A std::vector representing polynomial coefficients.
+ * \param timings [out] Wall-clock seconds spent in each phase.
+ * \param tol [in] Tolerance that mimics zero.
+ * \param method [in] Engine finding simple roots (default: ABERTH).
+ * \param nthreads [in] Number of threads for the refinement (default: 1).
+ *
+ * \return A std::vector of all roots.
+ */
+CArry yan_and_chieng_2006(const DArry &coeffs, PhaseTimings &timings,
+        const double tol=1e-10, const RootMethod method=RootMethod::ABERTH,
+        const unsigned nthreads=1);
 
 /**
  * \brief Overloaded output stream for CArry.
@@ -0,0 +1,229 @@
+/**
+ * \file basic_polynomial.h
+ * \brief Definition of class template BasicPolynomial, polynomials with a
+ *        generic scalar type.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# pragma once
+
+# include "basic.h"
+# include "polynomial.h"
+
+
+namespace simpoly
+{
+namespace poly
+{
+
+/**
+ * \brief Polynomials whose coefficients have the scalar type T.
+ *
+ * This class carries the coefficient algebra of Polynomial (evaluation,
+ * arithmetic, division, and calculus) in the precision of T, e.g., float for
+ * cheap post-processing or long double against ill-conditioning at high
+ * degree. Roots caching and special polynomials stay with Polynomial, which
+ * works in double; to_polynomial() converts to it. roots() starts from the
+ * double engine and, when T is wider than double, refines in T.
+ *
+ * A double-double scalar is not supported: the refinement needs
+ * std::complex<T>, which the standard only defines for float, double, and
+ * long double, and the library has no double-double type of its own.
+ *
+ * The library ships explicit instantiations for float, double, and
+ * long double, so clients do not instantiate the members themselves.
+ *
+ * \tparam T Scalar type of coefficients.
+ */
+template <typename T>
+class BasicPolynomial
+{
+public:
+
+    /** \brief Scalar type of coefficients. */
+    typedef T value_type;
+
+    /** \brief Default constructor: the zero polynomial. */
+    BasicPolynomial();
+
+    /**
+     * \brief Constructor using coefficients.
+     *
+     * \param coef [in] Coefficients, from the constant term up.
+     */
+    explicit BasicPolynomial(const basic::Arry<T> &coef);
+
+    /**
+     * \brief Conversion from another scalar type.
+     *
+     * \tparam U Scalar type of the other polynomial.
+     * \param p [in] The polynomial to convert.
+     */
+    template <typename U>
+    explicit BasicPolynomial(const BasicPolynomial<U> &p):
+        _coef(p.coef().begin(), p.coef().end()) {}
+
+    /**
+     * \brief Conversion from a Polynomial.
+     *
+     * \param p [in] The polynomial to convert.
+     */
+    explicit BasicPolynomial(const Polynomial &p);
+
+    /** \brief Destructor. */
+    virtual ~BasicPolynomial() = default;
+
+    /**
+     * \brief Get the degree.
+     *
+     * \return Degree.
+     */
+    unsigned degree() const;
+
+    /**
+     * \brief Get coefficients.
+     *
+     * \return Coefficients, from the constant term up.
+     */
+    const basic::Arry<T> &coef() const;
+
+    /**
+     * \brief Convert to a Polynomial (i.e., to double precision).
+     *
+     * \return The polynomial with coefficients rounded to double.
+     */
+    Polynomial to_polynomial() const;
+
+    /**
+     * \brief Roots in the precision of T.
+     *
+     * Polynomial finds the roots in double. When T is wider than double, they
+     * are the initial guesses of Aberth sweeps that evaluate the polynomial in
+     * T, so roots that double cannot resolve gain the extra digits of T;
+     * otherwise they are only rounded to T.
+     *
+     * \return All roots.
+     */
+    basic::Arry<std::complex<T>> roots() const;
+
+    /**
+     * \brief Evaluate at x.
+     *
+     * \param x [in] The location to evaluate.
+     *
+     * \return The value.
+     */
+    T operator()(const T x) const;
+
+    /**
+     * \brief Evaluate at many points.
+     *
+     * \param x [in] Locations to evaluate.
+     *
+     * \return Values.
+     */
+    basic::Arry<T> operator()(const basic::Arry<T> &x) const;
+
+    /**
+     * \brief Evaluate at many points into a raw buffer.
+     *
+     * Horner's scheme runs across points, i.e., the inner loop is over points
+     * and has no dependency between iterations, so it vectorizes; with float,
+     * twice as many points fit in a SIMD register as with double.
+     *
+     * \param n [in] Number of points.
+     * \param x [in] n locations.
+     * \param y [out] n values.
+     */
+    void evaluate(const unsigned n, const T *x, T *y) const;
+
+    /**
+     * \brief Get the derivative.
+     *
+     * \return The derivative.
+     */
+    BasicPolynomial deriv() const;
+
+    /**
+     * \brief Get the indefinite integral with zero constant term.
+     *
+     * \return The integral.
+     */
+    BasicPolynomial integ() const;
+
+    /**
+     * \brief Divide by a polynomial.
+     *
+     * \param divisor [in] The divisor.
+     * \param R [out] The remainder.
+     *
+     * \return The quotient.
+     */
+    BasicPolynomial divide(const BasicPolynomial &divisor, BasicPolynomial &R) const;
+
+    /** \brief Add a polynomial. */
+    BasicPolynomial &operator+=(const BasicPolynomial &rhs);
+
+    /** \brief Add a constant. */
+    BasicPolynomial &operator+=(const T &rhs);
+
+    /** \brief Subtract a polynomial. */
+    BasicPolynomial &operator-=(const BasicPolynomial &rhs);
+
+    /** \brief Subtract a constant. */
+    BasicPolynomial &operator-=(const T &rhs);
+
+    /** \brief Multiply by a polynomial. */
+    BasicPolynomial &operator*=(const BasicPolynomial &rhs);
+
+    /** \brief Multiply by a constant. */
+    BasicPolynomial &operator*=(const T &rhs);
+
+    /** \brief Divide by a constant. */
+    BasicPolynomial &operator/=(const T &rhs);
+
+protected:
+
+    basic::Arry<T> _coef; ///< coefficients
+};
+
+/** \brief Sum of two polynomials. */
+template <typename T>
+BasicPolynomial<T> operator+(BasicPolynomial<T> lhs, const BasicPolynomial<T> &rhs)
+{ lhs += rhs; return lhs; }
+
+/** \brief Difference of two polynomials. */
+template <typename T>
+BasicPolynomial<T> operator-(BasicPolynomial<T> lhs, const BasicPolynomial<T> &rhs)
+{ lhs -= rhs; return lhs; }
+
+/** \brief Product of two polynomials. */
+template <typename T>
+BasicPolynomial<T> operator*(BasicPolynomial<T> lhs, const BasicPolynomial<T> &rhs)
+{ lhs *= rhs; return lhs; }
+
+/** \brief Product of a polynomial and a constant. */
+template <typename T>
+BasicPolynomial<T> operator*(BasicPolynomial<T> lhs, const T &rhs)
+{ lhs *= rhs; return lhs; }
+
+/** \brief Product of a constant and a polynomial. */
+template <typename T>
+BasicPolynomial<T> operator*(const T &lhs, BasicPolynomial<T> rhs)
+{ rhs *= lhs; return rhs; }
+
+/** \brief Single-precision polynomials. */
+typedef BasicPolynomial<float> PolynomialF;
+
+/** \brief Extended-precision polynomials. */
+typedef BasicPolynomial<long double> PolynomialL;
+
+// instantiated in the library
+extern template class BasicPolynomial<float>;
+extern template class BasicPolynomial<double>;
+extern template class BasicPolynomial<long double>;
+
+} // end of namespace poly
+} // end of namespace simpoly
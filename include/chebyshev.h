@@ -0,0 +1,190 @@
+/**
+ * \file chebyshev.h
+ * \brief Definition of class Chebyshev, Chebyshev series on [-1, 1].
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# pragma once
+
+# include "basic.h"
+# include "polynomial.h"
+
+
+namespace simpoly
+{
+namespace poly
+{
+
+/**
+ * \brief Chebyshev series sum_k c_k T_k(x) on [-1, 1].
+ *
+ * Interpolation uses the n + 1 Chebyshev points of the second kind,
+ * x_j = cos(pi j / n), j = 0..n, i.e., from 1 down to -1. Values at these
+ * points and coefficients are related by a DCT-I, which the library computes
+ * with its own FFT in O(n log n) for any n.
+ */
+class Chebyshev
+{
+public:
+
+    /**
+     * \brief Constructor using Chebyshev coefficients.
+     *
+     * \param coef [in] Coefficients of T_0, T_1, ...
+     */
+    explicit Chebyshev(const basic::DArry &coef);
+
+    /**
+     * \brief Conversion from monomial coefficients, in O(n^2).
+     *
+     * \param p [in] The polynomial to convert.
+     */
+    explicit Chebyshev(const Polynomial &p);
+
+    /** \brief Destructor. */
+    virtual ~Chebyshev() = default;
+
+    /**
+     * \brief The Chebyshev points of the second kind.
+     *
+     * \param n [in] Degree of the interpolant; there are n + 1 points.
+     *
+     * \return Points cos(pi j / n), j = 0..n.
+     */
+    static basic::DArry points(const unsigned n);
+
+    /**
+     * \brief The interpolant of values at Chebyshev points.
+     *
+     * \param values [in] n + 1 values at points(n).
+     *
+     * \return The Chebyshev series of degree n.
+     */
+    static Chebyshev interpolate(const basic::DArry &values);
+
+    /**
+     * \brief The interpolant of a function at Chebyshev points.
+     *
+     * \tparam F A callable with signature double(double).
+     * \param f [in] The function.
+     * \param n [in] Degree of the interpolant.
+     *
+     * \return The Chebyshev series of degree n.
+     */
+    template <typename F>
+    static Chebyshev interpolate(const F &f, const unsigned n)
+    {
+        basic::DArry v = points(n);
+        for(auto &it: v) it = f(it);
+        return interpolate(v);
+    }
+
+    /**
+     * \brief Values at the Chebyshev points of the degree, i.e., the inverse
+     *        of interpolate().
+     *
+     * \return degree() + 1 values at points(degree()).
+     */
+    basic::DArry values() const;
+
+    /**
+     * \brief Get the degree.
+     *
+     * \return Degree.
+     */
+    unsigned degree() const;
+
+    /**
+     * \brief Get Chebyshev coefficients.
+     *
+     * \return Coefficients of T_0, T_1, ...
+     */
+    const basic::DArry &coef() const;
+
+    /**
+     * \brief Convert to monomial coefficients, in O(n^2).
+     *
+     * \return The same polynomial as a Polynomial.
+     */
+    Polynomial to_polynomial() const;
+
+    /**
+     * \brief Evaluate at x with Clenshaw's algorithm.
+     *
+     * \param x [in] The location to evaluate.
+     *
+     * \return The value.
+     */
+    double operator()(const double x) const;
+
+    /**
+     * \brief Evaluate at many points.
+     *
+     * \param x [in] Locations to evaluate.
+     *
+     * \return Values.
+     */
+    basic::DArry operator()(const basic::DArry &x) const;
+
+    /**
+     * \brief Evaluate at many points into a raw buffer.
+     *
+     * \param n [in] Number of points.
+     * \param x [in] n locations.
+     * \param y [out] n values.
+     */
+    void evaluate(const unsigned n, const double *x, double *y) const;
+
+    /**
+     * \brief Get the derivative, in O(n).
+     *
+     * \return The derivative.
+     */
+    Chebyshev deriv() const;
+
+    /**
+     * \brief Get the integral vanishing at x = -1, in O(n).
+     *
+     * \return The integral.
+     */
+    Chebyshev integ() const;
+
+    /** \brief Add a series. */
+    Chebyshev &operator+=(const Chebyshev &rhs);
+
+    /** \brief Subtract a series. */
+    Chebyshev &operator-=(const Chebyshev &rhs);
+
+    /** \brief Multiply by a series, using 2 T_m T_n = T_{m+n} + T_{|m-n|}. */
+    Chebyshev &operator*=(const Chebyshev &rhs);
+
+    /** \brief Multiply by a constant. */
+    Chebyshev &operator*=(const double &rhs);
+
+    /** \brief Divide by a constant. */
+    Chebyshev &operator/=(const double &rhs);
+
+protected:
+
+    basic::DArry _coef; ///< Chebyshev coefficients
+};
+
+/** \brief Sum of two series. */
+Chebyshev operator+(Chebyshev lhs, const Chebyshev &rhs);
+
+/** \brief Difference of two series. */
+Chebyshev operator-(Chebyshev lhs, const Chebyshev &rhs);
+
+/** \brief Product of two series. */
+Chebyshev operator*(Chebyshev lhs, const Chebyshev &rhs);
+
+/** \brief Product of a series and a constant. */
+Chebyshev operator*(Chebyshev lhs, const double &rhs);
+
+/** \brief Product of a constant and a series. */
+Chebyshev operator*(const double &lhs, Chebyshev rhs);
+
+} // end of namespace poly
+} // end of namespace simpoly
@@ -0,0 +1,340 @@
+/**
+ * \file complex_polynomial.h
+ * \brief Definition of class ComplexPolynomial, polynomials with complex
+ *        coefficients.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# pragma once
+
+# include <memory>
+# include <ostream>
+
+# include "basic.h"
+# include "polynomial.h"
+
+
+namespace simpoly
+{
+namespace poly
+{
+
+/**
+ * \brief Polynomials whose coefficients are complex numbers.
+ *
+ * The counterpart of Polynomial for complex coefficients, e.g., dispersion
+ * relations. It runs on the CArry instantiations of the kernels in `basic`,
+ * caches roots lazily in the same way, and hands out its coefficients by
+ * reference, so driving it costs no vector copies. Roots of a polynomial
+ * with complex coefficients do not come in conjugate pairs, so there is no
+ * split into real and complex roots.
+ */
+class ComplexPolynomial
+{
+public:
+
+    /** \brief Default constructor: the zero polynomial. */
+    ComplexPolynomial();
+
+    /**
+     * \brief Constructor using coefficients.
+     *
+     * \param coef [in] Coefficients, from the constant term up.
+     */
+    explicit ComplexPolynomial(const basic::CArry &coef);
+
+    /**
+     * \brief Constructor using the leading coefficient and roots.
+     *
+     * Values are evaluated from the roots afterward.
+     *
+     * \param l [in] The leading coefficient.
+     * \param roots [in] Roots.
+     */
+    ComplexPolynomial(const basic::Cmplx &l, const basic::CArry &roots);
+
+    /**
+     * \brief Constructor using coefficients and roots.
+     *
+     * Roots are cached, but values are still evaluated from the coefficients.
+     *
+     * \param coef [in] Coefficients, from the constant term up.
+     * \param roots [in] Roots.
+     */
+    ComplexPolynomial(const basic::CArry &coef, const basic::CArry &roots);
+
+    /**
+     * \brief Conversion from a Polynomial with real coefficients.
+     *
+     * \param p [in] The polynomial to convert.
+     */
+    explicit ComplexPolynomial(const Polynomial &p);
+
+    /** \brief Destructor. */
+    virtual ~ComplexPolynomial() = default;
+
+    /**
+     * \brief Reset coefficients; cached roots are discarded.
+     *
+     * \param coef [in] Coefficients.
+     */
+    void set(const basic::CArry &coef);
+
+    /**
+     * \brief Reset using the leading coefficient and roots.
+     *
+     * \param l [in] The leading coefficient.
+     * \param roots [in] Roots.
+     */
+    void set(const basic::Cmplx &l, const basic::CArry &roots);
+
+    /**
+     * \brief Reset both coefficients and roots.
+     *
+     * \param coef [in] Coefficients.
+     * \param roots [in] Roots.
+     */
+    void set(const basic::CArry &coef, const basic::CArry &roots);
+
+    /**
+     * \brief Reset only one coefficient; cached roots are discarded.
+     *
+     * \param d [in] The order of the term.
+     * \param value [in] The new coefficient.
+     */
+    void set(const int d, const basic::Cmplx &value);
+
+    /**
+     * \brief Reset the engine used to find roots.
+     *
+     * \param method [in] The root-finding engine (default: ABERTH).
+     */
+    void set(const basic::RootMethod &method);
+
+    /**
+     * \brief Reset the accuracy of evaluations and roots.
+     *
+     * \param accuracy [in] The accuracy mode (default: STANDARD).
+     */
+    void set(const basic::Accuracy &accuracy);
+
+    /**
+     * \brief Get the degree.
+     *
+     * \return Degree.
+     */
+    unsigned degree() const;
+
+    /**
+     * \brief Get coefficients.
+     *
+     * \return Coefficients, from the constant term up.
+     */
+    const basic::CArry &coef() const;
+
+    /**
+     * \brief Get the engine used to find roots.
+     *
+     * \return The root-finding engine.
+     */
+    basic::RootMethod root_method() const;
+
+    /**
+     * \brief Get the accuracy mode of evaluations and roots.
+     *
+     * \return The accuracy mode.
+     */
+    basic::Accuracy accuracy() const;
+
+    /**
+     * \brief Get statistics of the latest root finding of this polynomial.
+     *
+     * \return Statistics; all zeros unless built with SIMPOLY_ROOT_STATS.
+     */
+    const basic::RootStats &root_stats() const;
+
+    /**
+     * \brief Get a bool indicating whether values are evaluated from roots.
+     *
+     * \return The bool.
+     */
+    bool use_roots() const;
+
+    /**
+     * \brief Get all roots, calculated on the first call and cached.
+     *
+     * Multiple roots appear as consecutive identical copies.
+     *
+     * \return All roots.
+     */
+    const basic::CArry &roots() const;
+
+    /**
+     * \brief Get the derivative.
+     *
+     * \return The derivative.
+     */
+    ComplexPolynomial deriv() const;
+
+    /**
+     * \brief Get the indefinite integral with zero constant term.
+     *
+     * \return The integral.
+     */
+    ComplexPolynomial integ() const;
+
+    /**
+     * \brief Remove known roots in place.
+     *
+     * Cached roots are updated, or discarded if one of the given roots is
+     * not among them.
+     *
+     * \param roots [in] Roots to remove.
+     */
+    void deflate(const basic::CArry &roots);
+
+    /**
+     * \brief Divide by a polynomial.
+     *
+     * \param divisor [in] The divisor.
+     * \param R [out] The remainder.
+     *
+     * \return The quotient.
+     */
+    ComplexPolynomial divide(const ComplexPolynomial &divisor, ComplexPolynomial &R) const;
+
+    /**
+     * \brief Quotient of a division.
+     *
+     * \param divisor [in] The divisor.
+     *
+     * \return The quotient.
+     */
+    ComplexPolynomial quotient(const ComplexPolynomial &divisor) const;
+
+    /**
+     * \brief Remainder of a division.
+     *
+     * \param divisor [in] The divisor.
+     *
+     * \return The remainder.
+     */
+    ComplexPolynomial remainder(const ComplexPolynomial &divisor) const;
+
+    /**
+     * \brief Evaluate at x.
+     *
+     * \param x [in] The location to evaluate.
+     *
+     * \return The value.
+     */
+    basic::Cmplx operator()(const basic::Cmplx &x) const;
+
+    /**
+     * \brief Evaluate at many points.
+     *
+     * \param x [in] Locations to evaluate.
+     *
+     * \return Values.
+     */
+    basic::CArry operator()(const basic::CArry &x) const;
+
+    /**
+     * \brief Evaluate at many points into a raw buffer.
+     *
+     * With the standard accuracy, Horner's scheme runs across points, i.e.,
+     * the inner loop is over points and has no dependency between iterations.
+     *
+     * \param n [in] Number of points.
+     * \param x [in] n locations.
+     * \param y [out] n values.
+     */
+    void evaluate(const unsigned n, const basic::Cmplx *x, basic::Cmplx *y) const;
+
+    /** \brief Add a polynomial. */
+    ComplexPolynomial &operator+=(const ComplexPolynomial &rhs);
+
+    /** \brief Add a constant. */
+    ComplexPolynomial &operator+=(const basic::Cmplx &rhs);
+
+    /** \brief Subtract a polynomial. */
+    ComplexPolynomial &operator-=(const ComplexPolynomial &rhs);
+
+    /** \brief Subtract a constant. */
+    ComplexPolynomial &operator-=(const basic::Cmplx &rhs);
+
+    /** \brief Multiply by a polynomial; cached roots are merged if both have them. */
+    ComplexPolynomial &operator*=(const ComplexPolynomial &rhs);
+
+    /** \brief Multiply by a constant; cached roots are kept. */
+    ComplexPolynomial &operator*=(const basic::Cmplx &rhs);
+
+    /** \brief Divide by a constant; cached roots are kept. */
+    ComplexPolynomial &operator/=(const basic::Cmplx &rhs);
+
+    /** \brief Equal coefficients up to a relative difference of 1e-12. */
+    bool operator==(const ComplexPolynomial &rhs) const;
+
+    /** \brief Negation of operator==. */
+    bool operator!=(const ComplexPolynomial &rhs) const;
+
+protected:
+
+    bool _have_roots; ///< indicate if we already have roots in this instance
+    bool _use_roots; ///< indicate if using roots to evaluate values
+    basic::RootMethod _method = basic::RootMethod::ABERTH; ///< root-finding engine
+    basic::Accuracy _accuracy = basic::Accuracy::STANDARD; ///< accuracy mode
+
+    basic::CArry _coef; ///< coefficient array
+    basic::CArry _roots; ///< array holding roots
+    /** \brief Statistics of the latest root finding; only allocated when the
+     *         library collects statistics, so copies stay light otherwise. */
+    std::shared_ptr<basic::RootStats> _stats;
+
+    /** \brief Underlying function to get roots. */
+    void _get_roots() const;
+
+    /** \brief Discard cached roots. */
+    void _drop_roots();
+};
+
+/** \brief Sum of two polynomials. */
+ComplexPolynomial operator+(ComplexPolynomial lhs, const ComplexPolynomial &rhs);
+
+/** \brief Sum of a polynomial and a constant. */
+ComplexPolynomial operator+(ComplexPolynomial lhs, const basic::Cmplx &rhs);
+
+/** \brief Sum of a constant and a polynomial. */
+ComplexPolynomial operator+(const basic::Cmplx &lhs, ComplexPolynomial rhs);
+
+/** \brief Difference of two polynomials. */
+ComplexPolynomial operator-(ComplexPolynomial lhs, const ComplexPolynomial &rhs);
+
+/** \brief Difference of a polynomial and a constant. */
+ComplexPolynomial operator-(ComplexPolynomial lhs, const basic::Cmplx &rhs);
+
+/** \brief Difference of a constant and a polynomial. */
+ComplexPolynomial operator-(const basic::Cmplx &lhs, const ComplexPolynomial &rhs);
+
+/** \brief Product of two polynomials. */
+ComplexPolynomial operator*(ComplexPolynomial lhs, const ComplexPolynomial &rhs);
+
+/** \brief Product of a polynomial and a constant. */
+ComplexPolynomial operator*(ComplexPolynomial lhs, const basic::Cmplx &rhs);
+
+/** \brief Product of a constant and a polynomial. */
+ComplexPolynomial operator*(const basic::Cmplx &lhs, ComplexPolynomial rhs);
+
+/** \brief Quotient of a polynomial and a constant. */
+ComplexPolynomial operator/(ComplexPolynomial lhs, const basic::Cmplx &rhs);
+
+/** \brief Remainder of a division between polynomials. */
+ComplexPolynomial operator%(const ComplexPolynomial &lhs, const ComplexPolynomial &rhs);
+
+/** \brief Print coefficients. */
+std::ostream &operator<<(std::ostream &os, const ComplexPolynomial &rhs);
+
+} // end of namespace poly
+} // end of namespace simpoly
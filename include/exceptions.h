@@ -25,7 +25,7 @@
 
 # else
 
-    # define CHECK_COEFS(c)
+    # define CHECK_COEFS(c, tol)
 
 # endif
 
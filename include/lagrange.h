@@ -0,0 +1,152 @@
+/**
+ * \file lagrange.h
+ * \brief Definition of class Lagrange, a barycentric Lagrange basis.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# pragma once
+
+# include "basic.h"
+# include "polynomial.h"
+
+
+namespace simpoly
+{
+namespace poly
+{
+
+/**
+ * \brief Lagrange basis polynomials of a set of nodes in barycentric form.
+ *
+ * The basis polynomial of node j is
+ *      l_j(x) = (w_j / (x - x_j)) / sum_k (w_k / (x - x_k)),
+ * where w_j are the barycentric weights. Evaluating one or all basis
+ * polynomials at a point costs O(n), and adding a node costs O(n).
+ */
+class Lagrange
+{
+public:
+
+    /** \brief Default constructor. */
+    Lagrange() = default;
+
+    /**
+     * \brief Constructor using nodes.
+     *
+     * \param nodes [in] Distinct nodes.
+     */
+    explicit Lagrange(const basic::DArry &nodes);
+
+    /** \brief Destructor. */
+    virtual ~Lagrange() = default;
+
+    /**
+     * \brief Add a node and update the barycentric weights in O(n).
+     *
+     * \param x [in] The new node. It must differ from existing nodes;
+     *        otherwise PolynomialErrorGeneral is thrown.
+     */
+    void add_node(const double x);
+
+    /**
+     * \brief Get the number of nodes (i.e., the number of basis polynomials).
+     *
+     * \return The number of nodes.
+     */
+    unsigned size() const;
+
+    /**
+     * \brief Get the nodes.
+     *
+     * \return Nodes.
+     */
+    const basic::DArry &nodes() const;
+
+    /**
+     * \brief Get the barycentric weights.
+     *
+     * The weights are scaled by a common factor, which does not change the
+     * basis polynomials.
+     *
+     * \return Weights.
+     */
+    const basic::DArry &weights() const;
+
+    /**
+     * \brief Evaluate the j-th basis polynomial at x.
+     *
+     * \param j [in] Index of the basis polynomial.
+     * \param x [in] The location to evaluate.
+     *
+     * \return The value.
+     */
+    double operator()(const unsigned j, const double x) const;
+
+    /**
+     * \brief Evaluate all basis polynomials at x.
+     *
+     * \param x [in] The location to evaluate.
+     *
+     * \return The values of l_0(x) ... l_{n-1}(x).
+     */
+    basic::DArry operator()(const double x) const;
+
+    /**
+     * \brief Evaluate all basis polynomials at many points.
+     *
+     * \param x [in] m locations to evaluate.
+     * \param out [out] A row-major buffer of m*n doubles; out[k*n+j] = l_j(x_k).
+     */
+    void evaluate(const basic::DArry &x, double *out) const;
+
+    /**
+     * \brief Evaluate all basis polynomials at many points.
+     *
+     * \param x [in] m locations to evaluate.
+     *
+     * \return A row-major std::vector of m*n values; entry k*n+j is l_j(x_k).
+     */
+    basic::DArry evaluate(const basic::DArry &x) const;
+
+    /**
+     * \brief Evaluate the interpolant of given values at the nodes.
+     *
+     * \param values [in] Values at the n nodes.
+     * \param x [in] The location to evaluate.
+     *
+     * \return sum_j values[j] * l_j(x).
+     */
+    double interpolate(const basic::DArry &values, const double x) const;
+
+    /**
+     * \brief Convert the j-th basis polynomial to a Polynomial.
+     *
+     * The result is initialized by its roots (the other nodes), and its type
+     * is PolyType::LAGRANGE.
+     *
+     * \param j [in] Index of the basis polynomial.
+     *
+     * \return The basis polynomial.
+     */
+    Polynomial to_polynomial(const unsigned j) const;
+
+protected:
+
+    double _scale = 1.0; ///< common scaling factor of node differences
+    basic::DArry _nodes; ///< nodes
+    basic::DArry _weights; ///< barycentric weights
+
+    /**
+     * \brief Find the node that coincides with x.
+     *
+     * \param x [in] A location.
+     *
+     * \return The index of the node equal to x, or -1 if there is none.
+     */
+    int _find_node(const double x) const;
+};
+
+} // end of namespace poly
+} // end of namespace simpoly
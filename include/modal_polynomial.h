@@ -0,0 +1,179 @@
+/**
+ * \file modal_polynomial.h
+ * \brief Definition of class ModalPolynomial, polynomials with coefficients
+ *        in a Jacobi basis.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# pragma once
+
+# include "basic.h"
+# include "polynomial.h"
+
+
+namespace simpoly
+{
+namespace poly
+{
+
+/**
+ * \brief Polynomials stored as coefficients in a Jacobi(alpha, beta) basis.
+ *
+ * The polynomial is sum_k c_k P_k(x), where P_k are the Jacobi polynomials
+ * with the normalization of Jacobi(), i.e., Legendre polynomials when
+ * alpha = beta = 0. Everything runs on the three-term recurrence
+ *
+ *      P_{k+1} = (A_k x + B_k) P_k - C_k P_{k-1},
+ *
+ * so monomial coefficients, which are ill-conditioned at high degree, never
+ * appear unless requested through to_polynomial():
+ *
+ *  - evaluation uses Clenshaw's algorithm in O(n);
+ *  - derivatives differentiate the recurrence in O(n^2), or use the O(n)
+ *    Legendre identity P'_{k+1} - P'_{k-1} = (2k+1) P_k;
+ *  - products multiply by P_j through the recurrence, i.e., linearization
+ *    in O(nm) without tables of linearization coefficients;
+ *  - conversions from and to monomial coefficients cost O(n^2).
+ */
+class ModalPolynomial
+{
+public:
+
+    /**
+     * \brief Constructor using modal coefficients.
+     *
+     * \param coef [in] Coefficients of P_0, P_1, ...
+     * \param alpha [in] Jacobi parameter alpha > -1 (default: 0).
+     * \param beta [in] Jacobi parameter beta > -1 (default: 0).
+     */
+    explicit ModalPolynomial(const basic::DArry &coef,
+            const double alpha=0.0, const double beta=0.0);
+
+    /**
+     * \brief Conversion from monomial coefficients.
+     *
+     * \param p [in] The polynomial to convert.
+     * \param alpha [in] Jacobi parameter alpha > -1 (default: 0).
+     * \param beta [in] Jacobi parameter beta > -1 (default: 0).
+     */
+    explicit ModalPolynomial(const Polynomial &p,
+            const double alpha=0.0, const double beta=0.0);
+
+    /** \brief Destructor. */
+    virtual ~ModalPolynomial() = default;
+
+    /**
+     * \brief Get the degree.
+     *
+     * \return Degree.
+     */
+    unsigned degree() const;
+
+    /**
+     * \brief Get modal coefficients.
+     *
+     * \return Coefficients of P_0, P_1, ...
+     */
+    const basic::DArry &coef() const;
+
+    /** \brief Get the Jacobi parameter alpha. */
+    double alpha() const;
+
+    /** \brief Get the Jacobi parameter beta. */
+    double beta() const;
+
+    /**
+     * \brief Convert to monomial coefficients.
+     *
+     * \return The same polynomial as a Polynomial.
+     */
+    Polynomial to_polynomial() const;
+
+    /**
+     * \brief Evaluate at x with Clenshaw's algorithm.
+     *
+     * \param x [in] The location to evaluate.
+     *
+     * \return The value.
+     */
+    double operator()(const double x) const;
+
+    /**
+     * \brief Evaluate at many points.
+     *
+     * \param x [in] Locations to evaluate.
+     *
+     * \return Values.
+     */
+    basic::DArry operator()(const basic::DArry &x) const;
+
+    /**
+     * \brief Evaluate at many points into a raw buffer.
+     *
+     * Clenshaw's algorithm runs across points, i.e., the inner loop is over
+     * points and has no dependency between iterations.
+     *
+     * \param n [in] Number of points.
+     * \param x [in] n locations.
+     * \param y [out] n values.
+     */
+    void evaluate(const unsigned n, const double *x, double *y) const;
+
+    /**
+     * \brief Get the derivative, in the same basis.
+     *
+     * \return The derivative.
+     */
+    ModalPolynomial deriv() const;
+
+    /** \brief Add a polynomial in the same basis. */
+    ModalPolynomial &operator+=(const ModalPolynomial &rhs);
+
+    /** \brief Subtract a polynomial in the same basis. */
+    ModalPolynomial &operator-=(const ModalPolynomial &rhs);
+
+    /** \brief Multiply by a polynomial in the same basis. */
+    ModalPolynomial &operator*=(const ModalPolynomial &rhs);
+
+    /** \brief Multiply by a constant. */
+    ModalPolynomial &operator*=(const double &rhs);
+
+    /** \brief Divide by a constant. */
+    ModalPolynomial &operator/=(const double &rhs);
+
+protected:
+
+    double _alpha; ///< Jacobi parameter alpha
+    double _beta; ///< Jacobi parameter beta
+    basic::DArry _coef; ///< modal coefficients
+
+    basic::DArry _A; ///< recurrence coefficients A_k up to the degree
+    basic::DArry _B; ///< recurrence coefficients B_k up to the degree
+    basic::DArry _C; ///< recurrence coefficients C_k up to the degree
+
+    /** \brief Check parameters and tabulate the recurrence. */
+    void _setup();
+
+    /** \brief Throw if rhs uses another basis. */
+    void _check_basis(const ModalPolynomial &rhs) const;
+};
+
+/** \brief Sum of two polynomials in the same basis. */
+ModalPolynomial operator+(ModalPolynomial lhs, const ModalPolynomial &rhs);
+
+/** \brief Difference of two polynomials in the same basis. */
+ModalPolynomial operator-(ModalPolynomial lhs, const ModalPolynomial &rhs);
+
+/** \brief Product of two polynomials in the same basis. */
+ModalPolynomial operator*(ModalPolynomial lhs, const ModalPolynomial &rhs);
+
+/** \brief Product of a polynomial and a constant. */
+ModalPolynomial operator*(ModalPolynomial lhs, const double &rhs);
+
+/** \brief Product of a constant and a polynomial. */
+ModalPolynomial operator*(const double &lhs, ModalPolynomial rhs);
+
+} // end of namespace poly
+} // end of namespace simpoly
@@ -128,6 +128,28 @@ public:
      */
     void set(const PolyType &type);
 
+    /**
+     * \brief Reset the engine used to find roots.
+     *
+     * Roots calculated from coefficients are discarded and will be
+     * re-calculated with the new engine when needed.
+     *
+     * \param method [in] The root-finding engine (default: ABERTH).
+     */
+    void set(const basic::RootMethod &method);
+
+    /**
+     * \brief Reset the accuracy of evaluations and roots.
+     *
+     * With COMPENSATED, values from coefficients use the compensated Horner's
+     * scheme, and simple roots are polished with Newton steps on compensated
+     * residuals. Roots calculated from coefficients are discarded and will be
+     * re-calculated when needed.
+     *
+     * \param accuracy [in] The accuracy mode (default: STANDARD).
+     */
+    void set(const basic::Accuracy &accuracy);
+
     /**
      * \brief Reset coefficients and roots using coefficients.
      *
@@ -218,6 +240,31 @@ public:
      */
     PolyType type() const;
 
+    /**
+     * \brief Get the engine used to find roots.
+     *
+     * \return The root-finding engine.
+     */
+    basic::RootMethod root_method() const;
+
+    /**
+     * \brief Get the accuracy mode of evaluations and roots.
+     *
+     * \return The accuracy mode.
+     */
+    basic::Accuracy accuracy() const;
+
+    /**
+     * \brief Get statistics of the latest root finding of this polynomial.
+     *
+     * Statistics are only collected when the library is built with the CMake
+     * option SIMPOLY_ROOT_STATS; otherwise they stay zero. Roots given by
+     * users, or already found, do not update the statistics.
+     *
+     * \return The statistics.
+     */
+    const basic::RootStats &root_stats() const;
+
     /**
      * \brief Get a bool indicating whether we are using roots to evaluate
      *        values or not.
@@ -279,6 +326,23 @@ public:
      */
     basic::DArry real_roots(const double tol=1e-12) const;
 
+    /**
+     * \brief Get real roots in a closed interval [a, b].
+     *
+     * Unlike `real_roots`, this isolates real roots in the interval directly
+     * (see basic::real_roots_in) without calculating complex roots. Roots
+     * that can not be separated at the rounding level are reported once. If
+     * this polynomial was initialized with roots, those roots are used.
+     *
+     * \param a [in] Left end of the interval.
+     * \param b [in] Right end of the interval; requires a < b.
+     * \param tol [in] Tolerance of roots (default: 1e-12).
+     *
+     * \return Sorted real roots in [a, b].
+     */
+    basic::DArry real_roots_in(const double a, const double b,
+            const double tol=1e-12) const;
+
     /**
      * \brief Get a vector holding complex roots.
      *
@@ -320,6 +384,53 @@ public:
      */
     Polynomial integ() const;
 
+    /**
+     * \brief Get the Taylor shift p(x + c).
+     *
+     * Horner's shifting is used for low degrees and the FFT-based divide and
+     * conquer (basic::taylor_shift_fast) for high degrees.
+     *
+     * \param c [in] The shift.
+     *
+     * \return The shifted polynomial.
+     */
+    Polynomial shift(const double c) const;
+
+    /**
+     * \brief Get the composition with an affine map, p(s x + t).
+     *
+     * For example, a polynomial on [-1, 1] maps to [a, b] with
+     * s = 2 / (b - a) and t = -(a + b) / (b - a).
+     *
+     * \param s [in] The scale.
+     * \param t [in] The shift.
+     *
+     * \return The composed polynomial.
+     */
+    Polynomial compose_affine(const double s, const double t) const;
+
+    /**
+     * \brief Remove known roots from this polynomial in place.
+     *
+     * The coefficients are divided by all linear factors in one sweep (see
+     * basic::deflate). Cached roots, if any, lose the matching entries
+     * instead of being recomputed; if a root has no match in the cache, the
+     * cache is dropped and roots are found again when needed.
+     *
+     * \param roots [in] Real roots to remove, repeated by multiplicities.
+     */
+    void deflate(const basic::DArry &roots);
+
+    /**
+     * \brief Remove known roots from this polynomial in place.
+     *
+     * Complex roots must come in conjugate pairs; each pair is removed as a
+     * real quadratic factor, so coefficients stay real.
+     *
+     * \param roots [in] Roots to remove, repeated by multiplicities.
+     */
+    void deflate(const basic::CArry &roots);
+
     /**
      * \brief Divide by a polynomial.
      *
@@ -506,6 +617,8 @@ protected:
     PolyType _type; ///< the type of this polynomial
     bool _have_roots; ///< indicate if we already have roots in this instance
     bool _use_roots; ///< indicate if using roots to evaluate values
+    basic::RootMethod _method = basic::RootMethod::ABERTH; ///< root-finding engine
+    basic::Accuracy _accuracy = basic::Accuracy::STANDARD; ///< accuracy mode
 
     unsigned _d; ///< degree of this polynomial
     unsigned _nrr; ///< number of real roots
@@ -514,6 +627,9 @@ protected:
     basic::DArry _coef; ///< coefficient array
     basic::DArry _rroots; ///< array holding real roots
     basic::CArry _croots; ///< array holding complex roots
+    /** \brief Statistics of the latest root finding; only allocated when the
+     *         library collects statistics, so copies stay light otherwise. */
+    std::shared_ptr<basic::RootStats> _stats;
 
     /**
      * \brief Underlying private function to get roots.
@@ -521,6 +637,14 @@ protected:
      * \param tol [in] Tolerance mimics zero (default: 1e-12).
      */
     void _get_roots(const double tol=1e-12) const;
+
+    /**
+     * \brief Underlying function removing roots and updating cached roots.
+     *
+     * \param rroots [in] Real roots to remove.
+     * \param croots [in] Complex roots to remove, in conjugate pairs.
+     */
+    void _deflate(const basic::DArry &rroots, const basic::CArry &croots);
 };
 
 
@@ -569,6 +693,19 @@ Polynomial Legendre(const unsigned n);
 Polynomial Radau(const unsigned n, const PolyType type);
 
 
+/**
+ * \brief Composition of two polynomials, p(q(x)).
+ *
+ * See basic::compose for the baby-step giant-step algorithm.
+ *
+ * \param p [in] The outer polynomial.
+ * \param q [in] The inner polynomial.
+ *
+ * \return p(q(x)).
+ */
+Polynomial compose(const Polynomial &p, const Polynomial &q);
+
+
 Polynomial divide(const Polynomial &p1, const Polynomial &p2, Polynomial &R);
 Polynomial quotient(const Polynomial &p1, const Polynomial &p2);
 Polynomial remainder(const Polynomial &p1, const Polynomial &p2);
@@ -0,0 +1,166 @@
+/**
+ * \file ppoly.h
+ * \brief Definition of class PPoly, piecewise polynomials with contiguous
+ *        storage.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# pragma once
+
+# include <vector>
+
+# include "basic.h"
+# include "polynomial.h"
+
+
+namespace simpoly
+{
+namespace poly
+{
+
+/**
+ * \brief Piecewise polynomials over breakpoints b_0 < b_1 < ... < b_m.
+ *
+ * On interval i, [b_i, b_{i+1}), the polynomial is
+ * sum_j c_{ij} (x - b_i)^j, i.e., in the local coordinate of the interval,
+ * and all pieces share one degree k. Coefficients are stored contiguously,
+ * c[i * (k + 1) + j], so a piece is one cache-friendly block.
+ *
+ * Intervals are located in O(1) on uniform meshes, by bucketing, and with a
+ * branchless binary search otherwise. Points outside [b_0, b_m] use the
+ * first or the last piece.
+ */
+class PPoly
+{
+public:
+
+    /**
+     * \brief Constructor using pieces in the global coordinate x.
+     *
+     * \param breaks [in] m + 1 increasing breakpoints.
+     * \param pieces [in] m polynomials in x, one per interval.
+     */
+    PPoly(const basic::DArry &breaks, const std::vector<Polynomial> &pieces);
+
+    /**
+     * \brief Constructor using local coefficients.
+     *
+     * \param breaks [in] m + 1 increasing breakpoints.
+     * \param degree [in] The degree k of all pieces.
+     * \param coef [in] m * (k + 1) coefficients; c[i * (k + 1) + j] is the
+     *        coefficient of (x - b_i)^j on interval i.
+     */
+    PPoly(const basic::DArry &breaks, const unsigned degree, const basic::DArry &coef);
+
+    /** \brief Destructor. */
+    virtual ~PPoly() = default;
+
+    /**
+     * \brief Get the number of intervals.
+     *
+     * \return m.
+     */
+    unsigned size() const;
+
+    /**
+     * \brief Get the degree shared by all pieces.
+     *
+     * \return k.
+     */
+    unsigned degree() const;
+
+    /**
+     * \brief Get breakpoints.
+     *
+     * \return m + 1 breakpoints.
+     */
+    const basic::DArry &breaks() const;
+
+    /**
+     * \brief Get local coefficients.
+     *
+     * \return m * (k + 1) coefficients.
+     */
+    const basic::DArry &coef() const;
+
+    /**
+     * \brief Whether the breakpoints are uniformly spaced.
+     *
+     * \return The bool.
+     */
+    bool uniform() const;
+
+    /**
+     * \brief Get one piece in the global coordinate x.
+     *
+     * \param i [in] Index of the interval.
+     *
+     * \return The polynomial.
+     */
+    Polynomial piece(const unsigned i) const;
+
+    /**
+     * \brief Locate the interval of a point.
+     *
+     * \param x [in] The point.
+     *
+     * \return i such that b_i <= x < b_{i+1}, clamped to [0, m - 1].
+     */
+    unsigned find(const double x) const;
+
+    /**
+     * \brief Evaluate at x.
+     *
+     * \param x [in] The location to evaluate.
+     *
+     * \return The value.
+     */
+    double operator()(const double x) const;
+
+    /**
+     * \brief Evaluate at many points.
+     *
+     * \param x [in] Locations to evaluate, in any order.
+     *
+     * \return Values.
+     */
+    basic::DArry operator()(const basic::DArry &x) const;
+
+    /**
+     * \brief Evaluate at many points into a raw buffer.
+     *
+     * Points are binned by interval with a counting sort, and each bin is
+     * evaluated with Horner's scheme across its points, so every coefficient
+     * block is loaded once per call regardless of the order of x. With far
+     * fewer points than intervals, points are evaluated one by one instead.
+     *
+     * \param n [in] Number of points.
+     * \param x [in] n locations.
+     * \param y [out] n values.
+     */
+    void evaluate(const unsigned n, const double *x, double *y) const;
+
+    /**
+     * \brief Get the piecewise derivative.
+     *
+     * \return The derivative.
+     */
+    PPoly deriv() const;
+
+protected:
+
+    basic::DArry _breaks; ///< breakpoints
+    unsigned _k; ///< degree of all pieces
+    basic::DArry _coef; ///< local coefficients, one block per interval
+
+    bool _uniform; ///< whether breakpoints are uniformly spaced
+    double _inv_h; ///< inverse of the spacing of a uniform mesh
+
+    /** \brief Check breakpoints and build the index. */
+    void _setup();
+};
+
+} // end of namespace poly
+} // end of namespace simpoly
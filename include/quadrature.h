@@ -0,0 +1,175 @@
+/**
+ * \file quadrature.h
+ * \brief Quadrature rules and a process-wide registry caching them.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# pragma once
+
+# include <memory>
+# include <string>
+# include <vector>
+
+# include "basic.h"
+# include "polynomial.h"
+
+
+namespace simpoly
+{
+namespace poly
+{
+
+/**
+ * \brief An immutable quadrature rule on [-1, 1].
+ *
+ * A rule holds the nodes (in ascending order), the weights, and the
+ * coefficients of the polynomial whose roots are the nodes. Supported types:
+ *      LEGENDRE: Gauss-Legendre rule of n nodes;
+ *      JACOBI: Gauss-Jacobi rule of n nodes with weight (1-x)^alpha (1+x)^beta;
+ *      LEFTRADAU: Gauss-Radau rule of n nodes including x = -1;
+ *      RIGHTRADAU: Gauss-Radau rule of n nodes including x = 1.
+ *
+ * Alpha and beta are only meaningful to JACOBI and are zero for other types.
+ */
+class QuadratureRule
+{
+public:
+
+    /**
+     * \brief Constructor that generates a rule through root finding.
+     *
+     * \param type [in] LEGENDRE, JACOBI, LEFTRADAU, or RIGHTRADAU.
+     * \param n [in] Number of nodes.
+     * \param alpha [in] Alpha parameter of JACOBI (default: 0).
+     * \param beta [in] Beta parameter of JACOBI (default: 0).
+     */
+    QuadratureRule(const PolyType type, const unsigned n,
+            const double alpha=0.0, const double beta=0.0);
+
+    /**
+     * \brief Constructor that wraps existing arrays without copying.
+     *
+     * `data` must point to 3n+1 contiguous doubles: the n+1 coefficients of
+     * the node polynomial, followed by the n nodes and the n weights. The
+     * shared pointer keeps the underlying memory (e.g., a memory-mapped
+     * file) alive as long as the rule exists.
+     *
+     * \param type [in] LEGENDRE, JACOBI, LEFTRADAU, or RIGHTRADAU.
+     * \param n [in] Number of nodes.
+     * \param alpha [in] Alpha parameter of JACOBI.
+     * \param beta [in] Beta parameter of JACOBI.
+     * \param data [in] Shared pointer to the arrays.
+     */
+    QuadratureRule(const PolyType type, const unsigned n,
+            const double alpha, const double beta,
+            const std::shared_ptr<const double> &data);
+
+    /** \brief Get the type of this rule. */
+    PolyType type() const;
+
+    /** \brief Get the number of nodes. */
+    unsigned size() const;
+
+    /** \brief Get the alpha parameter. */
+    double alpha() const;
+
+    /** \brief Get the beta parameter. */
+    double beta() const;
+
+    /** \brief Get a pointer to the n nodes. */
+    const double *nodes() const;
+
+    /** \brief Get a pointer to the n weights. */
+    const double *weights() const;
+
+    /** \brief Get a pointer to the n+1 coefficients of the node polynomial. */
+    const double *coef() const;
+
+protected:
+
+    PolyType _type; ///< the type of the rule
+    unsigned _n; ///< number of nodes
+    double _alpha; ///< alpha parameter of Jacobi rules
+    double _beta; ///< beta parameter of Jacobi rules
+
+    std::shared_ptr<const double> _data; ///< underlying storage of all arrays
+
+    const double *_coef; ///< coefficients of node polynomial (n+1 entries)
+    const double *_nodes; ///< nodes (n entries)
+    const double *_weights; ///< weights (n entries)
+};
+
+/** \brief Alias of a shared pointer to an immutable quadrature rule. */
+typedef std::shared_ptr<const QuadratureRule> RulePtr;
+
+
+/**
+ * \brief Get a quadrature rule from the process-wide registry.
+ *
+ * The first request of a (type, n, alpha, beta) combination builds the rule.
+ * Following requests return the same shared instance. Lookups of existing
+ * rules do not lock, so the function is cheap to call concurrently from
+ * multiple threads.
+ *
+ * \param type [in] LEGENDRE, JACOBI, LEFTRADAU, or RIGHTRADAU.
+ * \param n [in] Number of nodes.
+ * \param alpha [in] Alpha parameter of JACOBI (default: 0).
+ * \param beta [in] Beta parameter of JACOBI (default: 0).
+ *
+ * \return A shared pointer to the rule.
+ */
+RulePtr quadrature_rule(const PolyType type, const unsigned n,
+        const double alpha=0.0, const double beta=0.0);
+
+/**
+ * \brief Build rules of several orders ahead of time.
+ *
+ * \param type [in] LEGENDRE, JACOBI, LEFTRADAU, or RIGHTRADAU.
+ * \param orders [in] Numbers of nodes of the rules to build.
+ * \param alpha [in] Alpha parameter of JACOBI (default: 0).
+ * \param beta [in] Beta parameter of JACOBI (default: 0).
+ */
+void prewarm_quadrature_rules(const PolyType type,
+        const std::vector<unsigned> &orders,
+        const double alpha=0.0, const double beta=0.0);
+
+/**
+ * \brief Get all rules currently in the registry.
+ *
+ * \return A std::vector of shared pointers to the rules.
+ */
+std::vector<RulePtr> registered_quadrature_rules();
+
+/**
+ * \brief Write quadrature rules to a binary cache file.
+ *
+ * The file holds a 64-byte header (magic string, format version, byte-order
+ * mark, number of rules, payload size, and FNV-1a hash of the payload), a
+ * directory of the rules, and each rule's coefficients, nodes, and weights
+ * as a contiguous double array aligned to 64 bytes. The file is written to
+ * a temporary name and then renamed, so readers never see a partial file.
+ *
+ * \param path [in] Path to the cache file.
+ * \param rules [in] Rules to store.
+ */
+void save_quadrature_rules(const std::string &path,
+        const std::vector<RulePtr> &rules);
+
+/**
+ * \brief Map a binary cache file into memory and register its rules.
+ *
+ * The arrays are used in place through `mmap`; nothing is copied. The mapping
+ * stays alive as long as any rule from the file does. Rules already in the
+ * registry are kept. A missing file, or a file whose magic string, version,
+ * byte order, size, or hash does not match, is ignored.
+ *
+ * \param path [in] Path to the cache file.
+ *
+ * \return The number of rules registered from the file.
+ */
+unsigned load_quadrature_rules(const std::string &path);
+
+} // end of namespace poly
+} // end of namespace simpoly
@@ -0,0 +1,119 @@
+/**
+ * \file spectral.h
+ * \brief Builders of pseudospectral matrices through barycentric formulas.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# pragma once
+
+# include "basic.h"
+
+
+namespace simpoly
+{
+namespace spectral
+{
+
+/**
+ * \brief Barycentric weights of a set of distinct nodes.
+ *
+ * The weights are w_j = 1 / prod_{k!=j} (x_j - x_k), scaled by a common
+ * factor to avoid overflow and underflow for many nodes. Barycentric formulas
+ * are invariant under such a common factor. Coincident nodes throw
+ * PolynomialErrorGeneral, and so do all matrix builders below.
+ *
+ * \param nodes [in] Distinct nodes.
+ *
+ * \return Barycentric weights.
+ */
+basic::DArry barycentric_weights(const basic::DArry &nodes);
+
+/**
+ * \brief Differentiation matrix on a set of nodes.
+ *
+ * D_ij = l_j'(x_i), where l_j is the Lagrange basis polynomial of node j. So
+ * applying D to the values of a function at the nodes gives the values of the
+ * derivative of its interpolant. It costs O(n^2).
+ *
+ * \param nodes [in] Distinct nodes, x_0 ... x_{n-1}.
+ * \param D [out] A row-major buffer holding at least n*n doubles.
+ * \param nthreads [in] Number of threads building rows (default: 1).
+ */
+void differentiation_matrix(const basic::DArry &nodes, double *D,
+        const unsigned nthreads=1);
+
+/**
+ * \brief Differentiation matrix on a set of nodes.
+ *
+ * Overloaded version that returns a row-major std::vector of n*n entries.
+ *
+ * \param nodes [in] Distinct nodes, x_0 ... x_{n-1}.
+ * \param nthreads [in] Number of threads building rows (default: 1).
+ *
+ * \return The matrix.
+ */
+basic::DArry differentiation_matrix(const basic::DArry &nodes,
+        const unsigned nthreads=1);
+
+/**
+ * \brief Interpolation matrix from a set of nodes to new points.
+ *
+ * M_kj = l_j(y_k). Applying M to the values at the nodes gives the values of
+ * the interpolant at the new points. It costs O(m*n) for m new points.
+ *
+ * \param nodes [in] Distinct nodes, x_0 ... x_{n-1}.
+ * \param y [in] New points, y_0 ... y_{m-1}.
+ * \param M [out] A row-major buffer holding at least m*n doubles.
+ * \param nthreads [in] Number of threads building rows (default: 1).
+ */
+void interpolation_matrix(const basic::DArry &nodes, const basic::DArry &y,
+        double *M, const unsigned nthreads=1);
+
+/**
+ * \brief Interpolation matrix from a set of nodes to new points.
+ *
+ * Overloaded version that returns a row-major std::vector of m*n entries.
+ *
+ * \param nodes [in] Distinct nodes, x_0 ... x_{n-1}.
+ * \param y [in] New points, y_0 ... y_{m-1}.
+ * \param nthreads [in] Number of threads building rows (default: 1).
+ *
+ * \return The matrix.
+ */
+basic::DArry interpolation_matrix(const basic::DArry &nodes,
+        const basic::DArry &y, const unsigned nthreads=1);
+
+/**
+ * \brief Integration matrix on a set of nodes.
+ *
+ * S_ij = integral of l_j(s) from a to x_i. Applying S to the values at the
+ * nodes gives the indefinite integral (starting from a) of the interpolant at
+ * the nodes. Each row uses a Gauss-Legendre rule exact for degree n-1, so
+ * building the matrix costs O(n^3 / 2).
+ *
+ * \param nodes [in] Distinct nodes, x_0 ... x_{n-1}.
+ * \param S [out] A row-major buffer holding at least n*n doubles.
+ * \param a [in] Lower limit of the integrals (default: -1).
+ * \param nthreads [in] Number of threads building rows (default: 1).
+ */
+void integration_matrix(const basic::DArry &nodes, double *S,
+        const double a=-1.0, const unsigned nthreads=1);
+
+/**
+ * \brief Integration matrix on a set of nodes.
+ *
+ * Overloaded version that returns a row-major std::vector of n*n entries.
+ *
+ * \param nodes [in] Distinct nodes, x_0 ... x_{n-1}.
+ * \param a [in] Lower limit of the integrals (default: -1).
+ * \param nthreads [in] Number of threads building rows (default: 1).
+ *
+ * \return The matrix.
+ */
+basic::DArry integration_matrix(const basic::DArry &nodes,
+        const double a=-1.0, const unsigned nthreads=1);
+
+} // end of namespace spectral
+} // end of namespace simpoly
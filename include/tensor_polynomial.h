@@ -0,0 +1,206 @@
+/**
+ * \file tensor_polynomial.h
+ * \brief Definition of class TensorPolynomial, tensor-product polynomials in
+ *        2D and 3D.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# pragma once
+
+# include <vector>
+
+# include "basic.h"
+# include "polynomial.h"
+
+
+namespace simpoly
+{
+namespace poly
+{
+
+/**
+ * \brief Tensor-product polynomials in 2D or 3D.
+ *
+ * A TensorPolynomial is
+ *
+ *      u(x, y, z) = sum_{i,j,k} c_{ijk} X_i(x) Y_j(y) Z_k(z),
+ *
+ * where X, Y, and Z are sets of 1D polynomials, e.g., Legendre(0..p) for a
+ * modal basis, and c is the coefficient tensor stored with i running fastest:
+ * c[i + nx * (j + ny * k)]. A product of single factors X(x) Y(y) Z(z) is the
+ * special case with one polynomial per direction. In 2D there is no Z.
+ *
+ * On tensor grids, values and gradients use sum factorization: the 1D bases
+ * are tabulated at the grid points once, and the coefficient tensor is
+ * contracted one direction at a time, costing O(p^{d+1}) per grid of
+ * O(p^d) points instead of O(p^{2d}).
+ */
+class TensorPolynomial
+{
+public:
+
+    /**
+     * \brief The product of two 1D polynomials, X(x) Y(y).
+     *
+     * \param X [in] The factor in x.
+     * \param Y [in] The factor in y.
+     */
+    TensorPolynomial(const Polynomial &X, const Polynomial &Y);
+
+    /**
+     * \brief The product of three 1D polynomials, X(x) Y(y) Z(z).
+     *
+     * \param X [in] The factor in x.
+     * \param Y [in] The factor in y.
+     * \param Z [in] The factor in z.
+     */
+    TensorPolynomial(const Polynomial &X, const Polynomial &Y, const Polynomial &Z);
+
+    /**
+     * \brief A 2D polynomial from 1D bases and a coefficient tensor.
+     *
+     * \param X [in] nx basis polynomials in x.
+     * \param Y [in] ny basis polynomials in y.
+     * \param coef [in] nx * ny coefficients, c[i + nx * j].
+     */
+    TensorPolynomial(const std::vector<Polynomial> &X,
+            const std::vector<Polynomial> &Y, const basic::DArry &coef);
+
+    /**
+     * \brief A 3D polynomial from 1D bases and a coefficient tensor.
+     *
+     * \param X [in] nx basis polynomials in x.
+     * \param Y [in] ny basis polynomials in y.
+     * \param Z [in] nz basis polynomials in z.
+     * \param coef [in] nx * ny * nz coefficients, c[i + nx * (j + ny * k)].
+     */
+    TensorPolynomial(const std::vector<Polynomial> &X,
+            const std::vector<Polynomial> &Y, const std::vector<Polynomial> &Z,
+            const basic::DArry &coef);
+
+    /** \brief Destructor. */
+    virtual ~TensorPolynomial() = default;
+
+    /**
+     * \brief Get the number of dimensions, 2 or 3.
+     *
+     * \return Number of dimensions.
+     */
+    unsigned dim() const;
+
+    /**
+     * \brief Get the 1D basis in a direction.
+     *
+     * \param axis [in] 0, 1, or 2 for x, y, or z.
+     *
+     * \return The basis polynomials.
+     */
+    const std::vector<Polynomial> &basis(const unsigned axis) const;
+
+    /**
+     * \brief Get the coefficient tensor.
+     *
+     * \return Coefficients, with i running fastest.
+     */
+    const basic::DArry &coef() const;
+
+    /**
+     * \brief Evaluate at a point of a 2D polynomial.
+     *
+     * \param x [in] x coordinate.
+     * \param y [in] y coordinate.
+     *
+     * \return The value.
+     */
+    double operator()(const double x, const double y) const;
+
+    /**
+     * \brief Evaluate at a point of a 3D polynomial.
+     *
+     * \param x [in] x coordinate.
+     * \param y [in] y coordinate.
+     * \param z [in] z coordinate.
+     *
+     * \return The value.
+     */
+    double operator()(const double x, const double y, const double z) const;
+
+    /**
+     * \brief Evaluate on the tensor grid x * y of a 2D polynomial.
+     *
+     * \param x [in] mx coordinates in x.
+     * \param y [in] my coordinates in y.
+     *
+     * \return mx * my values, u[p + mx * q] = u(x[p], y[q]).
+     */
+    basic::DArry evaluate(const basic::DArry &x, const basic::DArry &y) const;
+
+    /**
+     * \brief Evaluate on the tensor grid x * y * z of a 3D polynomial.
+     *
+     * \param x [in] mx coordinates in x.
+     * \param y [in] my coordinates in y.
+     * \param z [in] mz coordinates in z.
+     *
+     * \return mx * my * mz values, u[p + mx * (q + my * r)] = u(x[p], y[q], z[r]).
+     */
+    basic::DArry evaluate(const basic::DArry &x, const basic::DArry &y,
+            const basic::DArry &z) const;
+
+    /**
+     * \brief Values and gradients on the tensor grid x * y of a 2D polynomial.
+     *
+     * Outputs have the layout of evaluate().
+     *
+     * \param x [in] mx coordinates in x.
+     * \param y [in] my coordinates in y.
+     * \param u [out] Values.
+     * \param ux [out] Derivatives in x.
+     * \param uy [out] Derivatives in y.
+     */
+    void gradient(const basic::DArry &x, const basic::DArry &y,
+            basic::DArry &u, basic::DArry &ux, basic::DArry &uy) const;
+
+    /**
+     * \brief Values and gradients on the tensor grid x * y * z of a 3D
+     *        polynomial.
+     *
+     * Outputs have the layout of evaluate(). Partial contractions are shared
+     * between the four outputs.
+     *
+     * \param x [in] mx coordinates in x.
+     * \param y [in] my coordinates in y.
+     * \param z [in] mz coordinates in z.
+     * \param u [out] Values.
+     * \param ux [out] Derivatives in x.
+     * \param uy [out] Derivatives in y.
+     * \param uz [out] Derivatives in z.
+     */
+    void gradient(const basic::DArry &x, const basic::DArry &y,
+            const basic::DArry &z, basic::DArry &u, basic::DArry &ux,
+            basic::DArry &uy, basic::DArry &uz) const;
+
+protected:
+
+    unsigned _dim; ///< number of dimensions
+    std::vector<Polynomial> _basis[3]; ///< 1D bases; z holds the constant 1 in 2D
+    std::vector<Polynomial> _dbasis[3]; ///< derivatives of the 1D bases
+    basic::DArry _coef; ///< coefficient tensor
+
+    /** \brief Check sizes and tabulate derivatives of the bases. */
+    void _setup();
+
+    /**
+     * \brief Sum-factorized values and first derivatives on a tensor grid.
+     *
+     * Null outputs are skipped, and so are contractions only they need.
+     */
+    void _grid(const basic::DArry &x, const basic::DArry &y,
+            const basic::DArry &z, basic::DArry *u, basic::DArry *ux,
+            basic::DArry *uy, basic::DArry *uz) const;
+};
+
+} // end of namespace poly
+} // end of namespace simpoly
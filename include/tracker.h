@@ -0,0 +1,143 @@
+/**
+ * \file tracker.h
+ * \brief Definition of class RootTracker, warm-started roots of slowly varying
+ *        polynomials.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# pragma once
+
+# include <vector>
+
+# include "basic.h"
+# include "polynomial.h"
+
+
+namespace simpoly
+{
+namespace poly
+{
+
+/**
+ * \brief Roots of a sequence of polynomials whose coefficients change slowly.
+ *
+ * The tracker keeps the distinct roots and multiplicities of the previous
+ * polynomial. Each update starts Aberth iterations from them, with the
+ * correction of a root z_j of multiplicity m_j being
+ *      m_j p / (p' - p * sum_{k != j} m_k / (z_j - z_k)),
+ * so usually only a couple of sweeps are needed. The method of Yan & Chieng
+ * (2006) runs again only for the first polynomial, when the degree changes, or
+ * when the multiplicity structure seems to change: the warm start does not
+ * converge within a few sweeps, or two distinct roots come too close.
+ *
+ * Roots keep their order between warm-started updates, so the i-th root of
+ * consecutive steps follows the same branch.
+ */
+class RootTracker
+{
+public:
+
+    /**
+     * \brief Constructor.
+     *
+     * \param tol [in] Relative tolerance of roots.
+     * \param max_sweeps [in] Sweeps allowed for a warm start before falling
+     *                   back to the method of Yan & Chieng.
+     */
+    explicit RootTracker(const double tol=1e-10, const unsigned max_sweeps=20);
+
+    /** \brief Destructor. */
+    virtual ~RootTracker() = default;
+
+    /**
+     * \brief Find roots of the next polynomial.
+     *
+     * \param coeffs [in] Coefficients of the next polynomial.
+     *
+     * \return All roots, each repeated by its multiplicity.
+     */
+    const basic::CArry &update(const basic::DArry &coeffs);
+
+    /**
+     * \brief Find roots of the next polynomial.
+     *
+     * \param p [in] The next polynomial.
+     *
+     * \return All roots, each repeated by its multiplicity.
+     */
+    const basic::CArry &update(const Polynomial &p);
+
+    /** \brief Forget the previous roots, so the next update starts cold. */
+    void reset();
+
+    /**
+     * \brief Get the roots of the latest polynomial.
+     *
+     * \return All roots, each repeated by its multiplicity.
+     */
+    const basic::CArry &roots() const;
+
+    /**
+     * \brief Get the distinct roots of the latest polynomial.
+     *
+     * \return Distinct roots.
+     */
+    const basic::CArry &distinct_roots() const;
+
+    /**
+     * \brief Get the multiplicities of distinct roots.
+     *
+     * \return Multiplicities, in the order of distinct_roots().
+     */
+    const std::vector<unsigned> &multiplicities() const;
+
+    /**
+     * \brief Get the number of warm-started sweeps in the latest update.
+     *
+     * \return The number of sweeps; 0 if the latest update ran the method of
+     *         Yan & Chieng.
+     */
+    unsigned sweeps() const;
+
+    /**
+     * \brief Check whether the latest update ran the method of Yan & Chieng.
+     *
+     * \return True if the roots were recomputed from scratch.
+     */
+    bool rebuilt() const;
+
+protected:
+
+    double _tol; ///< relative tolerance of roots
+    unsigned _max_sweeps; ///< sweeps allowed for a warm start
+    unsigned _sweeps = 0; ///< sweeps of the latest update
+    bool _rebuilt = false; ///< whether the latest update started cold
+
+    basic::CArry _distinct; ///< distinct roots
+    std::vector<unsigned> _mult; ///< multiplicities of distinct roots
+    basic::CArry _roots; ///< roots repeated by multiplicities
+
+    /**
+     * \brief Warm-started Aberth sweeps on the distinct roots.
+     *
+     * \param coeffs [in] Coefficients of the polynomial.
+     *
+     * \return The number of sweeps, or 0 if the warm start failed.
+     */
+    unsigned _warm(const basic::CArry &coeffs);
+
+    /**
+     * \brief Roots and multiplicities through the method of Yan & Chieng.
+     *
+     * \param coeffs [in] Coefficients of the polynomial.
+     */
+    void _rebuild(const basic::CArry &coeffs);
+
+    /** \brief Expand distinct roots by their multiplicities into _roots. */
+    void _expand();
+};
+
+} // end of namespace poly
+} // end of namespace simpoly
@@ -0,0 +1,80 @@
+/**
+ * \file barycentric.h
+ * \brief Internal helpers building barycentric weights of Lagrange bases.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# pragma once
+
+# include <algorithm>
+
+# include "basic.h"
+# include "exceptions.h"
+
+
+namespace simpoly
+{
+namespace barycentric
+{
+
+/**
+ * \brief Common factor scaling differences of nodes.
+ *
+ * A product of n-1 differences of nodes in an interval of length L is of
+ * order (L/4)^(n-1) (the capacity of the interval), so it overflows or
+ * underflows for many nodes. Scaling every difference by 4/L keeps such
+ * products near O(1). Barycentric formulas are invariant under the scaling.
+ *
+ * \param nodes [in] Nodes.
+ *
+ * \return The factor 4/L, or 1 for fewer than two nodes. Throws
+ *         PolynomialErrorGeneral if all nodes coincide.
+ */
+inline double capacity_scale(const basic::DArry &nodes)
+{
+    if (nodes.size() < 2) return 1.0;
+
+    const auto mm = std::minmax_element(nodes.begin(), nodes.end());
+
+    // all nodes coincide: L = 0 would give an infinite factor and NaN weights
+    if (! (*mm.second > *mm.first)) throw exceptions::PolynomialErrorGeneral(
+            __FL__, "Nodes of barycentric weights must be distinct.");
+
+    return 4.0 / (*mm.second - *mm.first);
+}
+
+/**
+ * \brief Append a node and update all barycentric weights in O(n).
+ *
+ * With w_j = 1 / prod_{k!=j} s (x_j - x_k), a new node x divides every
+ * existing weight by s (x_j - x) and gets the weight 1 / prod_k s (x - x_k).
+ *
+ * \param nodes [in, out] Existing nodes; x is appended.
+ * \param weights [in, out] Weights of existing nodes; the new one is appended.
+ * \param scale [in] Common factor s of differences, e.g., capacity_scale.
+ * \param x [in] The new node; throws PolynomialErrorGeneral if it coincides
+ *        with an existing node.
+ */
+inline void add_node(basic::DArry &nodes, basic::DArry &weights,
+        const double scale, const double x)
+{
+    double w = 1.0;
+
+    for(unsigned k=0; k<nodes.size(); ++k)
+    {
+        const double diff = scale * (nodes[k] - x);
+        if (diff == 0.0) throw exceptions::PolynomialErrorGeneral(
+                __FL__, "Nodes of barycentric weights must be distinct.");
+
+        weights[k] /= diff;
+        w *= -diff;
+    }
+
+    nodes.push_back(x);
+    weights.push_back(1.0 / w);
+}
+
+} // end of namespace barycentric
+} // end of namespace simpoly
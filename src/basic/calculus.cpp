@@ -71,5 +71,10 @@ template CArry derivative(const CArry &coeffs);
 template DArry integral(const DArry &coeffs);
 template CArry integral(const CArry &coeffs);
 
+template FArry derivative(const FArry &coeffs);
+template LArry derivative(const LArry &coeffs);
+template FArry integral(const FArry &coeffs);
+template LArry integral(const LArry &coeffs);
+
 } // end of namespace basic
 } // end of namespace simpoly
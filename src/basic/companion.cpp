@@ -0,0 +1,446 @@
+/**
+ * \file companion.cpp
+ * \brief Roots as eigenvalues of the companion matrix (fast structured QR).
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+
+# include <algorithm>
+# include <cmath>
+# include <limits>
+# include <numeric>
+
+# include "basic.h"
+# include "exceptions.h"
+# include "../stats.h"
+
+
+namespace simpoly
+{
+namespace basic
+{
+
+// defined in root_findings.cpp
+CArry use_low_degree_formula(const CArry &P);
+
+namespace
+{
+
+// The companion matrix A of the monic polynomial is factored as A = Q R, where
+// Q is the cyclic shift and R is upper triangular and unitary-plus-rank-one.
+// Neither is stored as a matrix. Q is a descending product of core
+// transformations G_0 G_1 ... G_{n-2}, where G_i acts on rows i and i + 1.
+// R is padded to the (n + 1) x (n + 1) matrix
+//
+//      [ I  r'  0 ]
+//      [ 0  r  -1 ] = C^* (B + alpha e_0 e_{n-1}^T),
+//      [ 0  0   0 ]
+//
+// where C and B are descending products of n cores. The shifted QR sweeps only
+// ever pass cores through these sequences (turnovers) and merge them
+// (fusions), so every sweep costs O(n) and the storage is O(n). Entries of R
+// follow from the cores, e.g., R_jj = (B_j)_21 / (C_j)_21.
+//
+// See Aurentz, Mach, Vandebril and Watkins, Fast and backward stable
+// computation of roots of polynomials, SIAM J. Matrix Anal. Appl. 36 (2015).
+
+const double eps = std::numeric_limits<double>::epsilon(),
+             tiny = std::numeric_limits<double>::min(),
+             huge = std::numeric_limits<double>::max();
+
+// maximum number of Aberth corrections after the QR sweeps
+const unsigned max_refinements = 10;
+
+// core transformation [[c, -conj(s)], [s, conj(c)]], with |c|^2 + |s|^2 = 1
+struct Core
+{
+    Cmplx c, s;
+
+    Core(): c(1.0), s(0.0) {}
+    Core(const Cmplx &c, const Cmplx &s): c(c), s(s) {}
+
+    Cmplx m11() const { return c; }
+    Cmplx m12() const { return - std::conj(s); }
+    Cmplx m21() const { return s; }
+    Cmplx m22() const { return std::conj(c); }
+
+    Core adjoint() const { return Core(std::conj(c), - s); }
+};
+
+// the core whose first column is (x, y) / |(x, y)|, so that its adjoint takes
+// (x, y) to (|(x, y)|, 0); the plain norm is only replaced by the slower
+// scaled one when it over- or underflows
+Core make_core(const Cmplx &x, const Cmplx &y)
+{
+    const double n2 = std::norm(x) + std::norm(y);
+    const double nu = ((n2 > tiny) && (n2 < huge)) ?
+        std::sqrt(n2) : std::hypot(std::abs(x), std::abs(y));
+    if (nu == 0.0) return Core();
+    return Core(x / nu, y / nu);
+}
+
+// product of two cores acting on the same rows
+Core fuse(const Core &a, const Core &b)
+{
+    return make_core(a.m11() * b.m11() + a.m12() * b.m21(),
+                     a.m21() * b.m11() + a.m22() * b.m21());
+}
+
+// D G D^{-1} for the diagonal D = diag(d0, d1) of unit-modulus entries
+Core similar(const Core &g, const Cmplx &d0, const Cmplx &d1)
+{
+    return Core(g.c, g.s * d1 * std::conj(d0));
+}
+
+// the same core with the order of its rows and columns reversed
+Core flip(const Core &g) { return Core(std::conj(g.c), - std::conj(g.s)); }
+
+// turnover: a b c = x y z, where a, c, y act on rows (0, 1) and b, x, z act on
+// rows (1, 2) of a 3 x 3 block
+void turnover(const Core &a, const Core &b, const Core &c, Core &x, Core &y, Core &z)
+{
+    // M = a b c
+    Cmplx M[3][3] = {{c.m11(), c.m12(), 0.0}, {c.m21(), c.m22(), 0.0}, {0.0, 0.0, 1.0}};
+
+    for(unsigned j=0; j<3; ++j)
+    {
+        const Cmplx u = M[1][j], v = M[2][j];
+        M[1][j] = b.m11() * u + b.m12() * v;
+        M[2][j] = b.m21() * u + b.m22() * v;
+    }
+
+    for(unsigned j=0; j<3; ++j)
+    {
+        const Cmplx u = M[0][j], v = M[1][j];
+        M[0][j] = a.m11() * u + a.m12() * v;
+        M[1][j] = a.m21() * u + a.m22() * v;
+    }
+
+    // x^* zeroes M_20; y^* then takes the first column to e_0
+    x = make_core(M[1][0], M[2][0]);
+    const Core xa = x.adjoint();
+    for(unsigned j=0; j<3; ++j)
+    {
+        const Cmplx u = M[1][j], v = M[2][j];
+        M[1][j] = xa.m11() * u + xa.m12() * v;
+        M[2][j] = xa.m21() * u + xa.m22() * v;
+    }
+
+    y = make_core(M[0][0], M[1][0]);
+    const Core ya = y.adjoint();
+    for(unsigned j=1; j<3; ++j)
+        M[1][j] = ya.m21() * M[0][j] + ya.m22() * M[1][j];
+
+    z = make_core(M[1][1], M[2][1]);
+}
+
+// the mirrored turnover: a b c = x y z, where a, c, y act on rows (1, 2) and
+// b, x, z act on rows (0, 1)
+void turnover_up(const Core &a, const Core &b, const Core &c, Core &x, Core &y, Core &z)
+{
+    turnover(flip(a), flip(b), flip(c), x, y, z);
+    x = flip(x); y = flip(y); z = flip(z);
+}
+
+// the eigenvalue of [[a, b], [c, d]] closer to d
+Cmplx wilkinson_shift(const Cmplx &a, const Cmplx &b, const Cmplx &c, const Cmplx &d)
+{
+    const Cmplx h = 0.5 * (a - d);
+    Cmplx disc = std::sqrt(h * h + b * c);
+
+    // pick the sign that avoids cancellation in h + disc
+    if (std::real(std::conj(h) * disc) < 0.0) disc = -disc;
+
+    const Cmplx den = h + disc;
+    if (den == 0.0) return d;
+
+    return d - b * c / den;
+}
+
+// exponent e of the scaling x = 2^e y that brings the geometric mean of the
+// root moduli, |a_k / a_n|^(1 / (n - k)) with a_k the lowest non-zero
+// coefficient, to about one; a power of two keeps the scaling exact
+int scaling_exponent(const CArry &coeffs)
+{
+    const unsigned n = coeffs.size() - 1;
+
+    unsigned k = 0;
+    while (coeffs[k] == 0.0) ++k;
+    if (k == n) return 0;
+
+    const double lg = (std::log2(std::abs(coeffs[k])) - std::log2(std::abs(coeffs[n]))) / (n - k);
+    return int(std::lround(lg));
+}
+
+// coefficients of p(2^e y), divided by a power of two so that the largest one
+// is about one
+CArry scale(const CArry &coeffs, const int e)
+{
+    int top = std::numeric_limits<int>::min();
+    for(unsigned k=0; k<coeffs.size(); ++k)
+        if (coeffs[k] != 0.0) top = std::max(top, std::ilogb(std::abs(coeffs[k])) + e * int(k));
+
+    CArry b(coeffs.size());
+    for(unsigned k=0; k<coeffs.size(); ++k)
+    {
+        const int x = e * int(k) - top;
+        b[k] = Cmplx(std::ldexp(coeffs[k].real(), x), std::ldexp(coeffs[k].imag(), x));
+    }
+
+    return b;
+}
+
+// Aberth corrections of the eigenvalues on the original coefficients, with
+// residuals from the compensated Horner's scheme. The QR sweeps are backward
+// stable only relative to the norm of the coefficients, which is far from
+// enough for roots of polynomials whose coefficients vary widely in magnitude
+// (Wilkinson's, say); a few corrections recover them. A correction is kept
+// only if it lowers the residual, and a root stops at its first rejected or
+// negligible correction.
+void refine(const CArry &coeffs, CArry &rts)
+{
+    const unsigned n = rts.size();
+    const CArry d = derivative(coeffs);
+
+    CArry res(n);
+    for(unsigned i=0; i<n; ++i) res[i] = evaluate_compensated(coeffs, rts[i]);
+
+    std::vector<unsigned> active(n);
+    std::iota(active.begin(), active.end(), 0);
+
+    for(unsigned sweep=0; (sweep<max_refinements) && (! active.empty()); ++sweep)
+    {
+        unsigned n_active = 0;
+        for(const auto &i: active)
+        {
+            if (res[i] == 0.0) continue;
+
+            Cmplx S(0.0, 0.0);
+            for(unsigned j=0; j<i; ++j) S += 1.0 / (rts[i] - rts[j]);
+            for(unsigned j=i+1; j<n; ++j) S += 1.0 / (rts[i] - rts[j]);
+
+            const Cmplx ratio = res[i] / evaluate(d, rts[i]);
+            const Cmplx delta = ratio / (1.0 - ratio * S);
+            const Cmplx z = rts[i] - delta, pz = evaluate_compensated(coeffs, z);
+
+            // also rejects NaN from overflows
+            if (! (std::abs(pz) < std::abs(res[i]))) continue;
+
+            rts[i] = z;
+            res[i] = pz;
+            if (std::abs(delta) > eps * std::abs(z)) active[n_active++] = i;
+        }
+
+        active.resize(n_active);
+    }
+}
+
+// the factored companion matrix
+class Factored
+{
+public:
+
+    explicit Factored(const CArry &coeffs): n(coeffs.size() - 1), G(n - 1), B(n), C(n)
+    {
+        // Q = G_0 ... G_{n-2} with G_i = [[0, -1], [1, 0]] is the cyclic shift
+        // up to the sign (-1)^(n-1) of its last column, which goes to R
+        for(auto &it: G) it = Core(0.0, 1.0);
+
+        CArry xi(n + 1);
+        for(unsigned i=0; i+1<n; ++i) xi[i] = - coeffs[i+1] / coeffs[n];
+        xi[n-1] = ((n % 2 == 0) ? 1.0 : -1.0) * coeffs[0] / coeffs[n];
+        xi[n] = -1.0;
+
+        // C xi = alpha e_0, and B = C P with P = [[0, -1], [1, 0]] on rows
+        // (n - 1, n) as the unitary part of the padded R
+        Cmplx carry = xi[n];
+        for(unsigned i=n; i-->0; )
+        {
+            const double nu = std::hypot(std::abs(xi[i]), std::abs(carry));
+            C[i] = Core(std::conj(xi[i]) / nu, - carry / nu);
+            carry = nu;
+        }
+
+        B = C;
+        B[n-1] = fuse(C[n-1], Core(0.0, 1.0));
+    }
+
+    // degree
+    const unsigned n;
+
+    // whether A_{i+1,i} is negligible, either relative to its neighbours on
+    // the diagonal, as in dense QR, or to the norm of A; it is then set to
+    // zero. The relative test keeps small eigenvalues of graded matrices.
+    bool split(const unsigned i)
+    {
+        const double h = std::abs(G[i].s * r(i, i));
+        const double d = std::abs(q(i, i) * r(i, i)) + std::abs(q(i+1, i+1) * r(i+1, i+1));
+        if ((h >= eps * d) && (std::abs(G[i].s) >= eps)) return false;
+        G[i] = Core(G[i].c / std::abs(G[i].c), 0.0);
+        return true;
+    }
+
+    // A_ii, once A_{i,i-1} and A_{i+1,i} are zero
+    Cmplx eigenvalue(const unsigned i) const { return q(i, i) * r(i, i); }
+
+    // shift from the trailing 2 x 2 block of the window [lo, hi]
+    Cmplx shift(const unsigned lo, const unsigned hi, const bool exceptional) const
+    {
+        const unsigned k = hi;
+
+        // A = Q R with Q upper Hessenberg; the row above the window is
+        // decoupled by a zero G_{lo-1}.s
+        const bool top = (k - 1 > lo);
+        const Cmplx akk = q(k, k-1) * r(k-1, k) + q(k, k) * r(k, k),
+                    ak1 = q(k, k-1) * r(k-1, k-1);
+
+        if (exceptional) return akk + 0.75 * std::abs(ak1);
+
+        Cmplx a11 = q(k-1, k-1) * r(k-1, k-1),
+              a1k = q(k-1, k-1) * r(k-1, k) + q(k-1, k) * r(k, k);
+        if (top)
+        {
+            a11 += q(k-1, k-2) * r(k-2, k-1);
+            a1k += q(k-1, k-2) * r(k-2, k);
+        }
+
+        return wilkinson_shift(a11, a1k, ak1, akk);
+    }
+
+    // one single-shift QR sweep on the window [lo, hi]
+    void sweep(const unsigned lo, const unsigned hi, const Cmplx &mu)
+    {
+        // first column of A - mu I
+        Core U = make_core(q(lo, lo) * r(lo, lo) - mu, q(lo+1, lo) * r(lo, lo));
+
+        // U^* from the left merges into G_lo, past the diagonal G_{lo-1}
+        const Cmplx d = (lo > 0) ? G[lo-1].m22() : Cmplx(1.0);
+        G[lo] = fuse(similar(U.adjoint(), std::conj(d), 1.0), G[lo]);
+
+        // U from the right passes through R and then through Q, which leaves
+        // the bulge one row lower on the left
+        for(unsigned i=lo; i<hi; ++i)
+        {
+            Core W, V, b0, b1, c0, c1;
+
+            turnover(B[i], B[i+1], U, W, b0, b1);
+            B[i] = b0; B[i+1] = b1;
+
+            turnover_up(C[i+1].adjoint(), C[i].adjoint(), W, V, c1, c0);
+            C[i] = c0.adjoint(); C[i+1] = c1.adjoint();
+
+            if (i + 1 < hi)
+            {
+                Core g0, g1;
+                turnover(G[i], G[i+1], V, U, g0, g1);
+                G[i] = g0; G[i+1] = g1;
+            }
+            else // the bulge leaves through G_{hi-1}, past the diagonal G_hi
+            {
+                const Cmplx e = (hi + 1 < n) ? G[hi].m11() : Cmplx(1.0);
+                G[hi-1] = fuse(G[hi-1], similar(V, 1.0, e));
+            }
+        }
+    }
+
+private:
+
+    std::vector<Core> G, B, C;
+
+    // cores outside the sequences are the identity
+    Core g(const int i) const { return ((i < 0) || (i + 2 > int(n))) ? Core() : G[i]; }
+    Core b(const unsigned i) const { return (i < n) ? B[i] : Core(); }
+    Core c(const unsigned i) const { return (i < n) ? C[i] : Core(); }
+
+    // entries of the upper Hessenberg Q; only |i - j| <= 1 is needed
+    Cmplx q(const unsigned i, const unsigned j) const
+    {
+        if (i == j + 1) return g(j).m21();
+        if (i == j) return g(int(j)-1).m22() * g(j).m11();
+        return g(int(j)-2).m22() * g(j-1).m12() * g(j).m11(); // i == j - 1
+    }
+
+    // entries of R on and up to two above the diagonal, from the rows of
+    // C R = B + alpha e_0 e_{n-1}^T below the first one
+    Cmplx r(const unsigned i, const unsigned j) const
+    {
+        if (i == j) return b(i).m21() / c(i).m21();
+
+        if (j == i + 1)
+            return (b(i).m22() * b(i+1).m11() - c(i).m22() * c(i+1).m11() * r(i+1, i+1))
+                / c(i).m21();
+
+        // j == i + 2
+        const Cmplx t = c(i+1).m11() * r(i+1, i+2) + c(i+1).m12() * c(i+2).m11() * r(i+2, i+2);
+        return (b(i).m22() * b(i+1).m12() * b(i+2).m11() - c(i).m22() * t) / c(i).m21();
+    }
+};
+
+} // end of anonymous namespace
+
+
+// roots through eigenvalues of the companion matrix
+CArry companion_roots(const CArry &coeffs)
+{
+    CHECK_COEFS(coeffs, 1e-12);
+
+    // use exact solution for low-degree polynomials
+    if (coeffs.size() < 6) return use_low_degree_formula(coeffs);
+
+    // roots of p(x) are 2^e times those of p(2^e y)
+    const int e = scaling_exponent(coeffs);
+    Factored A(scale(coeffs, e));
+    const unsigned n = A.n;
+
+    CArry rts(n);
+
+    // single-shift QR sweeps on the active window [lo, hi]
+    int hi = n - 1;
+    unsigned its = 0, total = 0;
+
+    while (hi >= 0)
+    {
+        // find a negligible subdiagonal entry
+        int lo = hi;
+        for(; lo>0; --lo) if (A.split(lo-1)) break;
+
+        // a 1x1 block splits off
+        if (lo == hi)
+        {
+            rts[hi] = A.eigenvalue(hi);
+            hi -= 1;
+            its = 0;
+            continue;
+        }
+
+        its += 1;
+        total += 1;
+        if (total > 30 * n) throw exceptions::InfLoop(__FILE__, __LINE__);
+
+        // exceptional shift to break cycles
+        A.sweep(lo, hi, A.shift(lo, hi, its % 10 == 0));
+    }
+
+    SIMPOLY_STATS(s, s->iterations += total;
+            s->limit_ratio = std::max(s->limit_ratio, total / (30.0 * n)));
+
+    for(auto &it: rts) it = Cmplx(std::ldexp(it.real(), e), std::ldexp(it.imag(), e));
+
+    refine(coeffs, rts);
+
+    return rts;
+}
+
+
+// roots through eigenvalues of the companion matrix
+CArry companion_roots(const DArry &coeffs)
+{
+    CHECK_COEFS(coeffs, 1e-12);
+
+    return companion_roots(to_CArry(coeffs));
+}
+
+} // end of namespace basic
+} // end of namespace simpoly
@@ -0,0 +1,156 @@
+/**
+ * \file compensated.cpp
+ * \brief Compensated Horner's scheme and accurate Newton polishing.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+
+# include <cmath>
+
+# include "basic.h"
+# include "exceptions.h"
+# include "../eft.h"
+
+
+namespace simpoly
+{
+namespace basic
+{
+
+namespace
+{
+
+using eft::two_sum;
+using eft::two_prod;
+
+// one step s <- s * x + a of Horner's scheme; the rounding error is returned
+// through err
+inline double horner_step(const double s, const double x, const double a, double &err)
+{
+    double p, pi, r, sigma;
+    two_prod(s, x, p, pi);
+    two_sum(p, a, r, sigma);
+    err = pi + sigma;
+    return r;
+}
+
+inline Cmplx horner_step(const Cmplx &s, const Cmplx &x, const Cmplx &a, Cmplx &err)
+{
+    double p1, e1, p2, e2, p3, e3, p4, e4, h1, e5, h2, e6, re, e7, im, e8;
+
+    two_prod(s.real(), x.real(), p1, e1);
+    two_prod(s.imag(), x.imag(), p2, e2);
+    two_prod(s.real(), x.imag(), p3, e3);
+    two_prod(s.imag(), x.real(), p4, e4);
+
+    two_sum(p1, -p2, h1, e5);
+    two_sum(h1, a.real(), re, e6);
+    two_sum(p3, p4, h2, e7);
+    two_sum(h2, a.imag(), im, e8);
+
+    err = Cmplx((e1 - e2) + (e5 + e6), (e3 + e4) + (e7 + e8));
+    return Cmplx(re, im);
+}
+
+// one Newton step with a compensated residual; returns the step
+template <typename T>
+T accurate_step(const Arry<T> &coeffs, const Arry<T> &drv, const T x)
+{
+    const T d = evaluate_compensated(drv, x);
+    if (d == T(0.0)) return T(0.0);
+
+    return evaluate_compensated(coeffs, x) / d;
+}
+
+} // end of anonymous namespace
+
+
+// compensated Horner's scheme
+template <typename T>
+T evaluate_compensated(const Arry<T> &coeffs, const T x)
+{
+    CHECK_COEFS(coeffs, 1e-12);
+
+    T s = coeffs.back(), c = 0.0, err;
+
+    for(unsigned k=coeffs.size()-1; k-->0; )
+    {
+        s = horner_step(s, x, coeffs[k], err);
+        c = c * x + err; // the errors follow Horner's scheme in plain arithmetic
+    }
+
+    return s + c;
+}
+
+// evaluation with a given accuracy
+template <typename T>
+T evaluate(const Arry<T> &coeffs, const T x, const Accuracy accuracy)
+{
+    if (accuracy == Accuracy::COMPENSATED) return evaluate_compensated(coeffs, x);
+    return evaluate(coeffs, x);
+}
+
+// Newton steps with compensated residuals
+template <typename T>
+T polish(const Arry<T> &coeffs, const T x, const unsigned max_steps)
+{
+    CHECK_COEFS(coeffs, 1e-12);
+
+    const Arry<T> drv = derivative(coeffs);
+
+    T z = x;
+    double last = std::abs(evaluate_compensated(coeffs, z));
+
+    for(unsigned k=0; (k<max_steps) && (last != 0.0); ++k)
+    {
+        const T zn = z - accurate_step(coeffs, drv, z);
+        const double r = std::abs(evaluate_compensated(coeffs, zn));
+
+        // stop once the accurate residual no longer decreases
+        if (! (r < last)) break;
+
+        z = zn;
+        last = r;
+    }
+
+    return z;
+}
+
+// polish many roots
+void polish(const CArry &coeffs, CArry &roots, const unsigned max_steps)
+{
+    CHECK_COEFS(coeffs, 1e-12);
+
+    const unsigned n = roots.size();
+
+    for(unsigned i=0; i<n; ++i)
+    {
+        // copies of a multiple root are left alone: Newton's method converges
+        // slowly there, and the copies should stay identical
+        const bool repeated = ((i > 0) && (roots[i] == roots[i-1])) ||
+            ((i + 1 < n) && (roots[i+1] == roots[i]));
+
+        if (! repeated) roots[i] = polish(coeffs, roots[i], max_steps);
+    }
+}
+
+void polish(const DArry &coeffs, CArry &roots, const unsigned max_steps)
+{
+    CHECK_COEFS(coeffs, 1e-12);
+
+    polish(to_CArry(coeffs), roots, max_steps);
+}
+
+
+// explicit instantiation
+template double evaluate_compensated(const DArry &coeffs, const double x);
+template Cmplx evaluate_compensated(const CArry &coeffs, const Cmplx x);
+template double evaluate(const DArry &coeffs, const double x, const Accuracy accuracy);
+template Cmplx evaluate(const CArry &coeffs, const Cmplx x, const Accuracy accuracy);
+template double polish(const DArry &coeffs, const double x, const unsigned max_steps);
+template Cmplx polish(const CArry &coeffs, const Cmplx x, const unsigned max_steps);
+
+} // end of namespace basic
+} // end of namespace simpoly
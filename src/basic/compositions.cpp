@@ -0,0 +1,275 @@
+/**
+ * \file compositions.cpp
+ * \brief Taylor shifts and compositions of polynomials.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# include <algorithm>
+# include <cmath>
+
+# include "basic.h"
+# include "exceptions.h"
+# include "../fft.h"
+
+
+namespace simpoly
+{
+namespace basic
+{
+
+namespace
+{
+
+// below this length, Horner's shift beats the divide and conquer
+const unsigned shift_cutoff = 64;
+
+// below this degree of the outer polynomial, Horner's scheme composes faster
+const unsigned compose_cutoff = 16;
+
+// out += a * b, where b has nb coefficients
+void multiply_add(const DArry &a, const double *b, const unsigned nb, double *out)
+{
+    if (fft::use_fft(a.size(), nb))
+    {
+        const DArry r = fft::convolve(a, DArry(b, b + nb));
+        for(unsigned j=0; j<r.size(); ++j) out[j] += r[j];
+        return;
+    }
+
+    for(unsigned i=0; i<a.size(); ++i)
+        for(unsigned j=0; j<nb; ++j)
+            out[i+j] += a[i] * b[j];
+}
+
+// p(x + a) of the len coefficients at c, given pw[k] = (x + a)^(2^k)
+DArry shift_dc(const double *c, const unsigned len, const double a,
+        const std::vector<DArry> &pw)
+{
+    if (len <= shift_cutoff)
+    {
+        DArry r(c, c + len);
+        taylor_shift(r.data(), len, a);
+        return r;
+    }
+
+    unsigned k = 0;
+    while ((2u << k) < len) ++k;
+    const unsigned h = 1u << k;
+
+    // p_lo(x + a) + (x + a)^h p_hi(x + a)
+    DArry r = shift_dc(c, h, a, pw);
+    const DArry hi = shift_dc(c + h, len - h, a, pw);
+
+    r.resize(len, 0.0);
+    multiply_add(pw[k], hi.data(), hi.size(), r.data());
+
+    return r;
+}
+
+// p(q) by Horner's scheme, in place in out
+void compose_horner(const DArry &p, const DArry &q, double *out)
+{
+    const unsigned n = p.size() - 1, m = q.size() - 1;
+
+    out[0] = p[n];
+
+    // out <- out * q + p_i, from the top coefficient down so that nothing
+    // is overwritten before it is read
+    for(unsigned i=n, len=1; i-->0; len+=m)
+    {
+        for(unsigned t=len+m; t-->0; )
+        {
+            const unsigned lo = (t > len - 1) ? (t - len + 1) : 0,
+                           hi = std::min(t, m);
+
+            double v = 0.0;
+            for(unsigned b=lo; b<=hi; ++b) v += out[t-b] * q[b];
+            out[t] = v;
+        }
+
+        out[0] += p[i];
+    }
+}
+
+// adds sum_i P_{b0+i}(q) (q^k)^i, i < nb, to out, where P_i holds
+// coefficients ik to ik+k-1 of p, baby[j] = q^j and giant[g] = (q^k)^(2^g)
+void compose_dc(const DArry &p, const unsigned m, const unsigned k,
+        const std::vector<DArry> &baby, const std::vector<DArry> &giant,
+        const unsigned b0, const unsigned nb, double *out)
+{
+    const unsigned n = p.size() - 1;
+
+    // a linear combination of baby steps
+    if (nb == 1)
+    {
+        for(unsigned j=0; (j<k) && (b0*k+j<=n); ++j)
+        {
+            const double c = p[b0*k+j];
+            const DArry &qj = baby[j];
+            for(unsigned i=0; i<qj.size(); ++i) out[i] += c * qj[i];
+        }
+        return;
+    }
+
+    unsigned g = 0;
+    while ((2u << g) < nb) ++g;
+    const unsigned h = 1u << g;
+
+    // the lower half goes to out directly
+    compose_dc(p, m, k, baby, giant, b0, h, out);
+
+    // the upper half, times a giant step
+    const unsigned top = std::min(n, (b0 + nb) * k - 1);
+    DArry hi((top - (b0 + h) * k) * m + 1, 0.0);
+    compose_dc(p, m, k, baby, giant, b0 + h, nb - h, hi.data());
+
+    multiply_add(giant[g], hi.data(), hi.size(), out);
+}
+
+} // end of anonymous namespace
+
+
+template <typename T>
+void taylor_shift(T *c, const unsigned len, const T &a)
+{
+    for(unsigned i=0; i+1<len; ++i)
+        for(unsigned j=len-1; j-->i; )
+            c[j] += a * c[j+1];
+}
+
+
+template <typename T>
+Arry<T> taylor_shift(const Arry<T> &coeffs, const T &a)
+{
+    CHECK_COEFS(coeffs, 1e-12);
+
+    Arry<T> result(coeffs);
+    taylor_shift(result.data(), result.size(), a);
+
+    return result;
+}
+
+
+void taylor_shift(const DArry &coeffs, const unsigned m, const double *a, double *out)
+{
+    CHECK_COEFS(coeffs, 1e-12);
+
+    const unsigned len = coeffs.size();
+
+    // w[j * m + q] is coefficient j of the polynomial shifted to a[q]
+    DArry w(len * m);
+    for(unsigned j=0; j<len; ++j) std::fill(&w[j*m], &w[j*m] + m, coeffs[j]);
+
+    for(unsigned i=0; i+1<len; ++i)
+        for(unsigned j=len-1; j-->i; )
+        {
+            double *wj = &w[j*m];
+            const double *wj1 = wj + m;
+            for(unsigned q=0; q<m; ++q) wj[q] += a[q] * wj1[q];
+        }
+
+    for(unsigned q=0; q<m; ++q)
+        for(unsigned j=0; j<len; ++j)
+            out[q*len+j] = w[j*m+q];
+}
+
+
+DArry taylor_shift_fast(const DArry &coeffs, const double a)
+{
+    CHECK_COEFS(coeffs, 1e-12);
+
+    const unsigned len = coeffs.size();
+
+    // binomial powers (x + a)^h, h = 1, 2, 4, ... < len
+    std::vector<DArry> pw;
+    for(unsigned h=1; h<len; h<<=1)
+    {
+        DArry b(h+1);
+        b[h] = 1.0;
+        for(unsigned i=h; i-->0; ) b[i] = b[i+1] * a * double(i + 1) / double(h - i);
+        pw.push_back(b);
+    }
+
+    return shift_dc(coeffs.data(), len, a, pw);
+}
+
+
+void compose(const DArry &p, const DArry &q, double *out)
+{
+    CHECK_COEFS(p, 1e-12);
+    CHECK_COEFS(q, 1e-12);
+
+    const unsigned n = p.size() - 1, m = q.size() - 1;
+
+    if ((n == 0) || (m == 0)) { out[0] = evaluate(p, q[0]); return; }
+
+    // too few blocks to pay for the baby and giant steps
+    if (n < compose_cutoff) { compose_horner(p, q, out); return; }
+
+    // k blocks of k coefficients, k^2 >= n + 1
+    unsigned k = 1;
+    while (k * k < n + 1) ++k;
+    const unsigned nb = (n + k) / k;
+
+    // baby steps q^0 ... q^k
+    std::vector<DArry> baby(k+1);
+    baby[0].assign(1, 1.0);
+    for(unsigned j=1; j<=k; ++j)
+    {
+        baby[j].assign(j * m + 1, 0.0);
+        multiply_add(baby[j-1], q.data(), q.size(), baby[j].data());
+    }
+
+    // giant steps (q^k)^(2^g) by repeated squaring
+    std::vector<DArry> giant(1, baby[k]);
+    for(unsigned h=2; h<nb; h<<=1)
+    {
+        const DArry &G = giant.back();
+        DArry G2(2 * G.size() - 1, 0.0);
+        multiply_add(G, G.data(), G.size(), G2.data());
+        giant.push_back(std::move(G2));
+    }
+
+    std::fill(out, out + n * m + 1, 0.0);
+    compose_dc(p, m, k, baby, giant, 0, nb, out);
+}
+
+
+DArry compose(const DArry &p, const DArry &q)
+{
+    CHECK_COEFS(p, 1e-12);
+    CHECK_COEFS(q, 1e-12);
+
+    DArry result((p.size() - 1) * (q.size() - 1) + 1);
+    compose(p, q, result.data());
+    return result;
+}
+
+
+template <typename T>
+Arry<T> compose_affine(const Arry<T> &coeffs, const T &s, const T &t)
+{
+    Arry<T> result = taylor_shift(coeffs, t);
+
+    T sk(1.0);
+    for(auto &it: result) { it *= sk; sk *= s; }
+
+    // s = 0 leaves the constant p(t)
+    if (s == T(0.0)) result.resize(1);
+
+    return result;
+}
+
+
+// explicit instantiation
+template void taylor_shift(double *c, const unsigned len, const double &a);
+template void taylor_shift(Cmplx *c, const unsigned len, const Cmplx &a);
+template DArry taylor_shift(const DArry &coeffs, const double &a);
+template CArry taylor_shift(const CArry &coeffs, const Cmplx &a);
+template DArry compose_affine(const DArry &coeffs, const double &s, const double &t);
+template CArry compose_affine(const CArry &coeffs, const Cmplx &s, const Cmplx &t);
+
+} // end of namespace basic
+} // end of namespace simpoly
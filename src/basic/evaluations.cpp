@@ -40,6 +40,24 @@ T evaluate(const Arry<T> &coeffs, const T x)
 }
 
 
+template <typename T>
+T evaluate_with_derivative(const Arry<T> &coeffs, const T x, T &d)
+{
+    CHECK_COEFS(coeffs, 1e-12);
+
+    T p = coeffs.back();
+    d = T(0.0);
+
+    for(auto it=coeffs.rbegin()+1; it!=coeffs.rend(); ++it)
+    {
+        d = d * x + p;
+        p = p * x + *it;
+    }
+
+    return p;
+}
+
+
 template <typename T>
 T evaluate_from_root(const T l, const T* const &bg, const int degree, const T x)
 {
@@ -66,6 +84,10 @@ template double evaluate(const double* const &bg, const int len, const double x)
 template Cmplx evaluate(const Cmplx* const &bg, const int len, const Cmplx x);
 template double evaluate(const DArry &coeffs, const double x);
 template Cmplx evaluate(const CArry &coeffs, const Cmplx x);
+template double evaluate_with_derivative(
+        const DArry &coeffs, const double x, double &d);
+template Cmplx evaluate_with_derivative(
+        const CArry &coeffs, const Cmplx x, Cmplx &d);
 template double evaluate_from_root(const double l,
         const double* const &bg, const int degree, const double x);
 template Cmplx evaluate_from_root(const Cmplx l,
@@ -75,5 +97,15 @@ template double evaluate_from_root(
 template Cmplx evaluate_from_root(
         const Cmplx l, const CArry &roots, const Cmplx x);
 
+template float evaluate(const float* const &bg, const int len, const float x);
+template long double evaluate(const long double* const &bg, const int len,
+        const long double x);
+template float evaluate(const FArry &coeffs, const float x);
+template long double evaluate(const LArry &coeffs, const long double x);
+template float evaluate_with_derivative(
+        const FArry &coeffs, const float x, float &d);
+template long double evaluate_with_derivative(
+        const LArry &coeffs, const long double x, long double &d);
+
 } // end of namespace basic
 } // end of namespace simpoly
@@ -0,0 +1,391 @@
+/**
+ * \file isolation.cpp
+ * \brief Isolation and refinement of real roots in an interval.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+
+# include <algorithm>
+# include <cmath>
+# include <limits>
+
+# include "basic.h"
+# include "exceptions.h"
+# include "../eft.h"
+
+
+namespace simpoly
+{
+namespace basic
+{
+
+namespace
+{
+
+// an interval [l, r] of the unit parameter t with its Bernstein coefficients
+// and a bound of their rounding errors
+struct Node
+{
+    double l, r;
+    DArry b, e;
+};
+
+// a double-double number hi + lo
+struct DD
+{
+    double hi, lo;
+};
+
+inline DD mul(const DD &x, const double y)
+{
+    DD z;
+    double p, e;
+    eft::two_prod(x.hi, y, p, e);
+    eft::fast_two_sum(p, e + x.lo * y, z.hi, z.lo);
+    return z;
+}
+
+inline DD add(const DD &x, const DD &y)
+{
+    DD z;
+    double s, e;
+    eft::two_sum(x.hi, y.hi, s, e);
+    eft::fast_two_sum(s, e + (x.lo + y.lo), z.hi, z.lo);
+    return z;
+}
+
+inline DD div(const DD &x, const double y)
+{
+    DD z;
+    double p, e;
+    const double q = x.hi / y;
+    eft::two_prod(q, y, p, e);
+    eft::fast_two_sum(q, (((x.hi - p) - e) + x.lo) / y, z.hi, z.lo);
+    return z;
+}
+
+// Bernstein coefficients on [a, b] through Horner's scheme in Bernstein form;
+// multiplying by x = a (1-t) + b t only takes weighted averages, so it is
+// stable, unlike a Taylor shift followed by a change of basis. The scheme runs
+// in double-double, so the result is the rounded exact value up to an error of
+// order n^2 eps^2 times the same scheme on |p| with |a| and |b|.
+DArry to_bernstein(const DArry &p, const double a, const double b)
+{
+    const unsigned n = p.size() - 1;
+    std::vector<DD> c(n+1, {0.0, 0.0});
+
+    c[0].hi = p[n];
+    for(unsigned m=0; m<n; ++m) // c holds m+1 coefficients of degree m
+    {
+        // multiply by x and elevate the degree to m+1
+        c[m+1] = mul(c[m], b);
+        for(unsigned i=m; i>0; --i)
+            c[i] = div(add(mul(mul(c[i], a), m + 1 - i),
+                        mul(mul(c[i-1], b), i)), m + 1);
+        c[0] = mul(c[0], a);
+
+        for(unsigned i=0; i<=m+1; ++i) c[i] = add(c[i], {p[n-1-m], 0.0});
+    }
+
+    DArry result(n+1);
+    for(unsigned i=0; i<=n; ++i) result[i] = c[i].hi + c[i].lo;
+
+    return result;
+}
+
+// sign variations, ignoring coefficients at their rounding level
+unsigned sign_variations(const DArry &b, const DArry &e)
+{
+    unsigned v = 0;
+    int last = 0;
+
+    for(unsigned i=0; i<b.size(); ++i)
+    {
+        if (std::abs(b[i]) <= e[i]) continue;
+
+        const int s = (b[i] > 0.0) ? 1 : -1;
+        if (last * s < 0) v += 1;
+        last = s;
+    }
+
+    return v;
+}
+
+// the most sign variations if coefficients at their rounding level could take
+// either sign
+unsigned max_sign_variations(const DArry &b, const DArry &e)
+{
+    // best variations of sequences ending with a positive / negative sign
+    int pos = 0, neg = 0;
+
+    for(unsigned i=0; i<b.size(); ++i)
+    {
+        const int p = std::max(pos, neg + 1), n = std::max(neg, pos + 1);
+
+        if (std::abs(b[i]) <= e[i]) { pos = p; neg = n; }
+        else if (b[i] > 0.0) { pos = p; neg = -1000000; }
+        else { neg = n; pos = -1000000; }
+    }
+
+    return std::max(std::max(pos, neg), 0);
+}
+
+// sign of the first coefficient above its rounding level
+int first_sign(const DArry &b, const DArry &e)
+{
+    for(unsigned i=0; i<b.size(); ++i)
+        if (std::abs(b[i]) > e[i]) return (b[i] > 0.0) ? 1 : -1;
+
+    return 0;
+}
+
+// de Casteljau subdivision at tau
+void subdivide(const DArry &b, const double tau, DArry &left, DArry &right)
+{
+    const unsigned n = b.size() - 1;
+    DArry w(b);
+
+    left.resize(n+1);
+    right.resize(n+1);
+
+    left[0] = w[0];
+    right[n] = w[n];
+
+    for(unsigned j=1; j<=n; ++j)
+    {
+        for(unsigned i=0; i<=n-j; ++i) w[i] = (1.0 - tau) * w[i] + tau * w[i+1];
+        left[j] = w[0];
+        right[n-j] = w[n-j];
+    }
+}
+
+// divide p(t) = t q(t) by t, given b_0 = 0; B_{i+1}^n = t (n / (i+1)) B_i^{n-1}
+void deflate_left(DArry &b, DArry &e)
+{
+    const unsigned n = b.size() - 1;
+    const double eps = std::numeric_limits<double>::epsilon();
+
+    for(unsigned i=0; i<n; ++i)
+    {
+        b[i] = b[i+1] * n / (i + 1);
+        e[i] = e[i+1] * n / (i + 1) + 2.0 * eps * std::abs(b[i]);
+    }
+
+    b.pop_back();
+    e.pop_back();
+}
+
+// divide p(t) = (1-t) q(t) by 1-t, given b_n = 0; B_i^n = (1-t) (n / (n-i)) B_i^{n-1}
+void deflate_right(DArry &b, DArry &e)
+{
+    const unsigned n = b.size() - 1;
+    const double eps = std::numeric_limits<double>::epsilon();
+
+    for(unsigned i=0; i<n; ++i)
+    {
+        b[i] = b[i] * n / (n - i);
+        e[i] = e[i] * n / (n - i) + 2.0 * eps * std::abs(b[i]);
+    }
+
+    b.pop_back();
+    e.pop_back();
+}
+
+// whether x is an exact root of p with its coefficients perturbed by at most
+// eps relatively, i.e., |p(x)| <= eps p~(|x|); p(x) comes from the compensated
+// Horner's scheme, so the test is not spoiled by rounding errors of evaluation
+bool is_root(const DArry &coeffs, const DArry &absc, const double x)
+{
+    const double eps = std::numeric_limits<double>::epsilon();
+
+    return std::abs(evaluate_compensated(coeffs, x)) <=
+        eps * evaluate(absc, std::abs(x));
+}
+
+// safeguarded Newton-bisection in a bracket [xl, xr] with sign sl at xl; ka
+// and kb roots at the ends a and b of the whole interval have been divided
+// out, so Newton's steps are taken on p(x) / ((x-a)^ka (x-b)^kb)
+double refine(const DArry &coeffs, double xl, double xr, const int sl,
+        const double a, const unsigned ka, const double b, const unsigned kb,
+        const double tol)
+{
+    double x = 0.5 * (xl + xr);
+
+    for(unsigned iter=0; iter<200; ++iter)
+    {
+        double d;
+        evaluate_with_derivative(coeffs, x, d);
+        const double v = evaluate_compensated(coeffs, x);
+
+        if (v == 0.0) return x;
+
+        // shrink the bracket
+        if (((v > 0.0) ? 1 : -1) == sl) xl = x; else xr = x;
+
+        // take the Newton step only if it stays inside the bracket
+        const double r = d / v - ka / (x - a) - kb / (x - b);
+        double xn = ((r != 0.0) && std::isfinite(r)) ? x - 1.0 / r : xl;
+        if ((xn <= xl) || (xn >= xr)) xn = 0.5 * (xl + xr);
+
+        const double step = std::abs(xn - x);
+        x = xn;
+
+        if ((step <= tol * std::max(1.0, std::abs(x))) ||
+                (xr - xl <= tol * std::max(1.0, std::abs(x)))) return x;
+    }
+
+    return x;
+}
+
+} // end of anonymous namespace
+
+
+// real roots in [a, b] through Descartes' rule of signs in Bernstein basis
+DArry real_roots_in(const DArry &coeffs, const double a, const double b,
+        const double tol)
+{
+    CHECK_COEFS(coeffs, 1e-12);
+
+    if (! (a < b)) throw exceptions::PolynomialErrorGeneral(
+            __FL__, "The interval [a, b] requires a < b.");
+
+    DArry roots;
+
+    const unsigned n = coeffs.size() - 1;
+    if (n == 0) return roots;
+
+    const double h = b - a;
+    const double eps = std::numeric_limits<double>::epsilon();
+    const double gamma = 4.0 * (n + 1) * eps;
+
+    // the same scheme on |p| with |a| and |b| bounds the magnitude of terms,
+    // and hence the rounding errors of Bernstein coefficients
+    DArry absc(n+1);
+    for(unsigned k=0; k<=n; ++k) absc[k] = std::abs(coeffs[k]);
+    const DArry bound = to_bernstein(absc, std::abs(a), std::abs(b));
+
+    Node root{0.0, 1.0, to_bernstein(coeffs, a, b), DArry(n+1)};
+    for(unsigned i=0; i<=n; ++i)
+        root.e[i] = eps * std::abs(root.b[i]) + gamma * gamma * bound[i];
+
+    // sign counts skip end points at the rounding level, so check them here
+    // and divide their factors out; a multiple root is divided out as often as
+    // the next end coefficient vanishes
+    unsigned ka = 0, kb = 0;
+
+    if (is_root(coeffs, absc, a))
+    {
+        roots.push_back(a);
+        do { deflate_left(root.b, root.e); ka += 1; }
+        while ((root.b.size() > 1) && (std::abs(root.b.front()) <= root.e.front()));
+    }
+
+    if (is_root(coeffs, absc, b))
+    {
+        roots.push_back(b);
+        do { deflate_right(root.b, root.e); kb += 1; }
+        while ((root.b.size() > 1) && (std::abs(root.b.back()) <= root.e.back()));
+    }
+
+    // clusters: intervals where roots can not be separated
+    std::vector<std::pair<double, double>> clusters;
+
+    // depth-first subdivision; the left child is always processed first
+    std::vector<Node> stack;
+    stack.push_back(std::move(root));
+
+    while (! stack.empty())
+    {
+        Node node = std::move(stack.back());
+        stack.pop_back();
+
+        const double width = (node.r - node.l) * h;
+
+        // p is at the rounding level of its coefficients on the whole node, so
+        // a multiple root may have split into a complex pair
+        const double level = eps * evaluate(absc, std::max(
+                    std::abs(a + h * node.l), std::abs(a + h * node.r)));
+        bool tiny = true;
+        for(unsigned i=0; (i<node.b.size()) && tiny; ++i)
+            tiny = (std::abs(node.b[i]) <= node.e[i] + level);
+
+        const unsigned v = sign_variations(node.b, node.e);
+
+        // exactly one root: refine it in the original variable; the end
+        // coefficients are the values of p there, so they must bracket the root,
+        // otherwise a skipped coefficient may have changed the parity of v
+        const bool bracket = (std::abs(node.b.front()) > node.e.front()) &&
+            (std::abs(node.b.back()) > node.e.back());
+
+        if ((v == 1) && bracket)
+        {
+            roots.push_back(refine(coeffs, a + h * node.l, a + h * node.r,
+                        first_sign(node.b, node.e), a, ka, b, kb, tol));
+            continue;
+        }
+
+        // roots that can not be separated at this resolution
+        if (tiny || ((v > 0) && (width <= tol)))
+        {
+            if ((! clusters.empty()) && (clusters.back().second == node.l))
+                clusters.back().second = node.r;
+            else
+                clusters.push_back({node.l, node.r});
+            continue;
+        }
+
+        // no root, unless signs at the rounding level could hide a pair; such
+        // a pair is resolved by subdivision or dropped, but never reported
+        if ((v == 0) && ((width <= tol) ||
+                    (max_sign_variations(node.b, node.e) < 2)))
+            continue;
+
+        // split away from a root, so no root sits on the boundary of children
+        const double taus[] = {0.5, 0.4375, 0.5625, 0.375, 0.625};
+        double tau = 0.5, best = -1.0;
+        for(const auto &it: taus)
+        {
+            const double x = a + h * (node.l + it * (node.r - node.l));
+            if (! is_root(coeffs, absc, x)) { tau = it; break; }
+
+            const double val = std::abs(evaluate_compensated(coeffs, x));
+            if (val > best) { best = val; tau = it; }
+        }
+
+        // rounding errors of the parent plus those of de Casteljau's algorithm,
+        // at most 2 eps per level on the convex combinations of |b|
+        const unsigned m = node.b.size() - 1;
+        DArry err(m+1);
+        for(unsigned i=0; i<=m; ++i)
+            err[i] = node.e[i] + 2.0 * (m + 1) * eps * std::abs(node.b[i]);
+
+        Node left, right;
+        subdivide(node.b, tau, left.b, right.b);
+        subdivide(err, tau, left.e, right.e);
+
+        const double mid = node.l + tau * (node.r - node.l);
+        left.l = node.l; left.r = mid;
+        right.l = mid; right.r = node.r;
+
+        stack.push_back(std::move(right));
+        stack.push_back(std::move(left));
+    }
+
+    for(const auto &it: clusters)
+        roots.push_back(a + h * 0.5 * (it.first + it.second));
+
+    std::sort(roots.begin(), roots.end());
+
+    // an end point may also lie in a cluster
+    roots.erase(std::unique(roots.begin(), roots.end(),
+                [tol](double x, double y) {
+                    return y - x <= tol * std::max(1.0, std::abs(y)); }),
+            roots.end());
+
+    return roots;
+}
+
+} // end of namespace basic
+} // end of namespace simpoly
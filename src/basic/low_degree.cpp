@@ -0,0 +1,293 @@
+/**
+ * \file low_degree.cpp
+ * \brief Batched closed-form roots of real cubics and quartics (SoA layout).
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+
+# include <algorithm>
+# include <cmath>
+
+# include "basic.h"
+
+
+namespace simpoly
+{
+namespace basic
+{
+
+namespace
+{
+
+// The batches are processed in blocks of `block` polynomials. Every case of
+// the closed forms is computed for all lanes of a block and then selected, and
+// the calls to acos/cos/cbrt, which the compiler can only vectorize with a
+// vector math library, are hoisted into a pass of their own. The remaining
+// passes are straight-line arithmetic and square roots of arguments that are
+// non-negative by construction, and they vectorize across lanes (this file is
+// compiled without errno and floating-point traps for that reason, see
+// src/CMakeLists.txt).
+
+const unsigned block = 64;
+
+const double two_pi_3 = 2.09439510239319549231;
+
+// roots of the real monic quadratic y^2 + B y + C
+inline void quadratic_lane(const double B, const double C,
+        double &r1, double &i1, double &r2, double &i2)
+{
+    const double hb = -0.5 * B, disc = hb * hb - C;
+    const double sq = std::sqrt(std::abs(disc));
+
+    // two real roots without cancellation
+    const double t = hb + std::copysign(sq, hb);
+    const double u = (t != 0.0) ? C / t : 0.0;
+
+    const bool real = (disc >= 0.0);
+    r1 = real ? t : hb;
+    r2 = real ? u : hb;
+    i1 = real ? 0.0 : sq;
+    i2 = real ? 0.0 : -sq;
+}
+
+// one Newton step for the real monic cubic x^3 + a x^2 + b x + c
+inline double newton_cubic(const double a, const double b, const double c,
+        const double x)
+{
+    const double f = ((x + a) * x + b) * x + c;
+    const double df = (3.0 * x + 2.0 * a) * x + b;
+    return (df != 0.0) ? x - f / df : x;
+}
+
+// one block of real monic cubics x^3 + a x^2 + b x + c; x0 is always real
+struct CubicBlock
+{
+    double a[block], b[block], c[block];
+    double x0[block], r1[block], i1[block], r2[block], i2[block];
+
+    // intermediates
+    double a3[block], hp[block], hq[block], disc[block], rr[block],
+           arg[block], w[block], y[block], t1[block], t2[block];
+};
+
+void cubic_block(CubicBlock &k, const unsigned n)
+{
+    for(unsigned i=0; i<n; ++i)
+    {
+        const double a = k.a[i], b = k.b[i], c = k.c[i];
+        const double a3 = a / 3.0;
+        const double hp = (b - a * a3) / 3.0, hq = 0.5 * (c + a3 * (2.0 * a3 * a3 - b));
+        const double disc = hq * hq + hp * hp * hp;
+
+        // three real roots: argument of the trigonometric form
+        const double rr = std::sqrt(std::max(-hp, 0.0));
+        const double r3 = rr * rr * rr;
+        k.arg[i] = (r3 > 0.0) ? std::min(std::max(-hq / r3, -1.0), 1.0) : 0.0;
+
+        // one real root: the larger cube of Cardano's formula
+        k.w[i] = std::abs(hq) + std::sqrt(std::max(disc, 0.0));
+
+        k.a3[i] = a3; k.hp[i] = hp; k.hq[i] = hq; k.disc[i] = disc; k.rr[i] = rr;
+    }
+
+    // the libm pass; it also picks the first root, as the compiler would
+    // otherwise sink the loads of the unused case into branches
+    for(unsigned i=0; i<n; ++i)
+    {
+        const double phi = std::acos(k.arg[i]) / 3.0;
+        const double t0 = 2.0 * k.rr[i] * std::cos(phi);
+        k.t1[i] = 2.0 * k.rr[i] * std::cos(phi - two_pi_3);
+        k.t2[i] = 2.0 * k.rr[i] * std::cos(phi + two_pi_3);
+
+        const double u = -std::copysign(std::cbrt(k.w[i]), k.hq[i]);
+        const double v = (u != 0.0) ? -k.hp[i] / u : 0.0;
+
+        k.y[i] = ((k.disc[i] <= 0.0) ? t0 : u + v) - k.a3[i];
+    }
+
+    for(unsigned i=0; i<n; ++i)
+    {
+        const double a = k.a[i], b = k.b[i], c = k.c[i], a3 = k.a3[i];
+        const double t1 = k.t1[i], t2 = k.t2[i];
+
+        const bool three = (k.disc[i] <= 0.0);
+        const double x = newton_cubic(a, b, c, k.y[i]);
+
+        // the other two roots from the deflated quadratic x^2 + B x + C; the
+        // constant term comes from the product of roots when |x| is large
+        const double B = a + x;
+        const double C = (std::abs(x) > 1.0) ? -c / x : b + x * B;
+
+        double q1, qi1, q2, qi2;
+        quadratic_lane(B, C, q1, qi1, q2, qi2);
+
+        const double x1 = newton_cubic(a, b, c, t1 - a3),
+                     x2 = newton_cubic(a, b, c, t2 - a3);
+
+        k.x0[i] = x;
+        k.r1[i] = three ? x1 : q1;
+        k.r2[i] = three ? x2 : q2;
+        k.i1[i] = three ? 0.0 : qi1;
+        k.i2[i] = three ? 0.0 : qi2;
+    }
+}
+
+// one block of real monic quartics x^4 + a x^3 + b x^2 + c x + d
+struct QuarticBlock
+{
+    double a[block], b[block], c[block], d[block];
+    double re[4][block], im[4][block];
+
+    // intermediates; the resolvent cubic is solved in `cubic`
+    double a4[block], p[block], q[block], r[block];
+    CubicBlock cubic;
+};
+
+void quartic_block(QuarticBlock &k, const unsigned n)
+{
+    for(unsigned i=0; i<n; ++i)
+    {
+        const double a = k.a[i], b = k.b[i], c = k.c[i], d = k.d[i];
+        const double a4 = 0.25 * a;
+        const double p = b - 6.0 * a4 * a4,
+                     q = c - 2.0 * a4 * b + 8.0 * a4 * a4 * a4,
+                     r = d - a4 * c + a4 * a4 * b - 3.0 * a4 * a4 * a4 * a4;
+
+        // resolvent m^3 + p m^2 + (p^2/4 - r) m - q^2/8
+        k.cubic.a[i] = p;
+        k.cubic.b[i] = 0.25 * p * p - r;
+        k.cubic.c[i] = -0.125 * q * q;
+
+        k.a4[i] = a4; k.p[i] = p; k.q[i] = q; k.r[i] = r;
+    }
+
+    cubic_block(k.cubic, n);
+
+    for(unsigned i=0; i<n; ++i)
+    {
+        const double a = k.a[i], b = k.b[i], c = k.c[i], d = k.d[i];
+        const double a4 = k.a4[i], p = k.p[i], q = k.q[i], r = k.r[i];
+
+        // the largest real root of the resolvent
+        const double m1 = k.cubic.r1[i], m2 = k.cubic.r2[i];
+        double m = k.cubic.x0[i];
+        m = (k.cubic.i1[i] == 0.0) ? std::max(m, m1) : m;
+        m = (k.cubic.i2[i] == 0.0) ? std::max(m, m2) : m;
+        m = std::max(m, 0.0);
+
+        // general case: (y^2 - s y + h + g) (y^2 + s y + h - g)
+        const double s = std::sqrt(2.0 * m), h = 0.5 * p + m;
+        const double g = (s > 0.0) ? 0.5 * q / s : 0.0;
+
+        // biquadratic case (m = 0, so q = 0)
+        const double bd = 0.25 * p * p - r, sbd = std::sqrt(std::abs(bd));
+        const double sr = std::sqrt(std::max(r, 0.0)), t = std::sqrt(std::max(2.0 * sr - p, 0.0));
+
+        const bool general = (m > 0.0), split = (bd >= 0.0);
+        const double B1 = general ? -s : (split ? 0.0 : t),
+                     C1 = general ? h + g : (split ? 0.5 * p + sbd : sr),
+                     B2 = general ? s : (split ? 0.0 : -t),
+                     C2 = general ? h - g : (split ? 0.5 * p - sbd : sr);
+
+        double re[4], im[4];
+        quadratic_lane(B1, C1, re[0], im[0], re[1], im[1]);
+        quadratic_lane(B2, C2, re[2], im[2], re[3], im[3]);
+
+        for(unsigned j=0; j<4; ++j)
+        {
+            const double x = re[j] - a4;
+
+            // one Newton step on real roots
+            const double f = (((x + a) * x + b) * x + c) * x + d;
+            const double df = ((4.0 * x + 3.0 * a) * x + 2.0 * b) * x + c;
+            const double dr = (im[j] == 0.0) ? df : 0.0;
+            k.re[j][i] = (dr != 0.0) ? x - f / dr : x;
+            k.im[j][i] = im[j];
+        }
+    }
+}
+
+} // end of anonymous namespace
+
+
+// batched roots of real cubics
+void cubic_roots(const unsigned N, const double *coeffs, double *re, double *im)
+{
+    const double *c0 = coeffs, *c1 = c0 + N, *c2 = c1 + N, *c3 = c2 + N;
+
+    CubicBlock k;
+
+    for(unsigned i0=0; i0<N; i0+=block)
+    {
+        const unsigned n = std::min(block, N - i0);
+
+        for(unsigned i=0; i<n; ++i)
+        {
+            const double inv = 1.0 / c3[i0+i];
+            k.a[i] = c2[i0+i] * inv;
+            k.b[i] = c1[i0+i] * inv;
+            k.c[i] = c0[i0+i] * inv;
+        }
+
+        cubic_block(k, n);
+
+        std::copy(k.x0, k.x0 + n, re + i0);
+        std::copy(k.r1, k.r1 + n, re + N + i0);
+        std::copy(k.r2, k.r2 + n, re + 2 * N + i0);
+        std::fill(im + i0, im + i0 + n, 0.0);
+        std::copy(k.i1, k.i1 + n, im + N + i0);
+        std::copy(k.i2, k.i2 + n, im + 2 * N + i0);
+    }
+}
+
+
+// batched roots of real quartics
+void quartic_roots(const unsigned N, const double *coeffs, double *re, double *im)
+{
+    const double *c0 = coeffs, *c1 = c0 + N, *c2 = c1 + N,
+                 *c3 = c2 + N, *c4 = c3 + N;
+
+    QuarticBlock k;
+    double rev[block];
+
+    for(unsigned i0=0; i0<N; i0+=block)
+    {
+        const unsigned n = std::min(block, N - i0);
+
+        // when the product of roots is large, the shift a/4 of Ferrari's
+        // method swamps small roots; solve for reciprocal roots instead
+        for(unsigned i=0; i<n; ++i)
+        {
+            const double e0 = c0[i0+i], e1 = c1[i0+i], e2 = c2[i0+i],
+                         e3 = c3[i0+i], e4 = c4[i0+i];
+            const bool r = std::abs(e0) > std::abs(e4);
+            const double inv = 1.0 / (r ? e0 : e4);
+            k.a[i] = (r ? e1 : e3) * inv;
+            k.b[i] = e2 * inv;
+            k.c[i] = (r ? e3 : e1) * inv;
+            k.d[i] = (r ? e4 : e0) * inv;
+            rev[i] = r ? 1.0 : 0.0;
+        }
+
+        quartic_block(k, n);
+
+        for(unsigned j=0; j<4; ++j)
+        {
+            double *rj = re + j * N + i0, *ij = im + j * N + i0;
+
+            for(unsigned i=0; i<n; ++i)
+            {
+                const double lr = k.re[j][i], li = k.im[j][i];
+                const double n2 = (rev[i] != 0.0) ? lr * lr + li * li : 1.0;
+                const double ri = li / n2;
+                rj[i] = lr / n2;
+                ij[i] = (rev[i] != 0.0) ? -ri : ri;
+            }
+        }
+    }
+}
+
+} // end of namespace basic
+} // end of namespace simpoly
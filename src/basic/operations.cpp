@@ -8,10 +8,13 @@
 
 # include <algorithm>
 # include <numeric>
+# include <array>
 # include <cmath>
 
 # include "basic.h"
 # include "exceptions.h"
+# include "../fft.h"
+# include "../stats.h"
 
 
 namespace simpoly
@@ -193,6 +196,324 @@ DArry to_DArry(const CArry &p, const double tol)
 }
 
 
+namespace
+{
+
+// from this degree of the divisor on, GCD jumps with the half GCD
+const unsigned hgcd_cutoff = 2048;
+
+// below this degree, the half GCD runs its remainder steps one by one
+const unsigned hgcd_base = 48;
+
+// maximum modulus of coefficients
+template <typename T>
+double maxabs(const T *p, const unsigned len)
+{
+    double m = 0.0;
+    for(unsigned k=0; k<len; ++k) m = std::max(m, std::abs(p[k]));
+    return m;
+}
+
+template <typename T>
+double maxabs(const Arry<T> &p) { return maxabs(p.data(), p.size()); }
+
+// product without trimming; empty arrays are the zero polynomial
+template <typename T>
+Arry<T> schoolbook(const Arry<T> &a, const Arry<T> &b)
+{
+    if (a.empty() || b.empty()) return Arry<T>();
+
+    Arry<T> r(a.size() + b.size() - 1, T(0));
+    for(unsigned i=0; i<a.size(); ++i)
+        for(unsigned j=0; j<b.size(); ++j)
+            r[i+j] += a[i] * b[j];
+    return r;
+}
+
+// length-n spectra of the sequences x; each one is scaled to unit maximum in
+// the transform, and real ones share a transform in pairs, as in fft::convolve
+void forward(const std::vector<const DArry*> &x, const unsigned n, std::vector<CArry> &X)
+{
+    const DArry none;
+
+    X.resize(x.size());
+    for(unsigned i=0; i<x.size(); i+=2)
+    {
+        const DArry &p = *x[i], &q = (i + 1 < x.size()) ? *x[i+1] : none;
+        const double sp = std::max(maxabs(p), 1e-300), sq = std::max(maxabs(q), 1e-300);
+
+        CArry z(n, 0.0);
+        for(unsigned j=0; j<p.size(); ++j) z[j].real(p[j] / sp);
+        for(unsigned j=0; j<q.size(); ++j) z[j].imag(q[j] / sq);
+        fft::fft(z);
+
+        X[i].resize(n);
+        if (i + 1 < x.size()) X[i+1].resize(n);
+        for(unsigned k=0; k<n; ++k)
+        {
+            const Cmplx zk = z[k], zc = std::conj(z[(n - k) & (n - 1)]);
+            X[i][k] = (0.5 * sp) * (zk + zc);
+            if (i + 1 < x.size()) X[i+1][k] = Cmplx(0.0, -0.5 * sq) * (zk - zc);
+        }
+    }
+}
+
+void forward(const std::vector<const CArry*> &x, const unsigned n, std::vector<CArry> &X)
+{
+    X.resize(x.size());
+    for(unsigned i=0; i<x.size(); ++i)
+    {
+        const double s = std::max(maxabs(*x[i]), 1e-300);
+
+        X[i].assign(n, 0.0);
+        for(unsigned j=0; j<x[i]->size(); ++j) X[i][j] = (*x[i])[j] / s;
+        fft::fft(X[i]);
+        for(auto &it: X[i]) it *= s;
+    }
+}
+
+// the first len[i] coefficients of the inverse transforms of X
+void backward(const std::vector<CArry> &X, const std::vector<unsigned> &len,
+        std::vector<DArry> &x)
+{
+    const unsigned n = X[0].size();
+
+    x.resize(X.size());
+    for(unsigned i=0; i<X.size(); i+=2)
+    {
+        const bool pair = (i + 1 < X.size());
+        const double sp = std::max(maxabs(X[i]), 1e-300),
+                     sq = pair ? std::max(maxabs(X[i+1]), 1e-300) : 1.0;
+
+        CArry z(n);
+        for(unsigned k=0; k<n; ++k)
+            z[k] = X[i][k] / sp + (pair ? Cmplx(0.0, 1.0) * X[i+1][k] / sq : Cmplx(0.0));
+        fft::fft(z, true);
+
+        x[i].resize(len[i]);
+        for(unsigned j=0; j<len[i]; ++j) x[i][j] = sp * z[j].real();
+        if (! pair) continue;
+        x[i+1].resize(len[i+1]);
+        for(unsigned j=0; j<len[i+1]; ++j) x[i+1][j] = sq * z[j].imag();
+    }
+}
+
+void backward(const std::vector<CArry> &X, const std::vector<unsigned> &len,
+        std::vector<CArry> &x)
+{
+    x.resize(X.size());
+    for(unsigned i=0; i<X.size(); ++i)
+    {
+        x[i] = X[i];
+        fft::fft(x[i], true);
+        x[i].resize(len[i]);
+    }
+}
+
+// r[o] = x[t[0]] y[t[1]] + x[t[2]] y[t[3]] for the index quadruples t = id[o];
+// every x and every y goes through one transform however often it is used
+template <typename T>
+std::vector<Arry<T>> sums_of_products(const std::vector<const Arry<T>*> &x,
+        const std::vector<const Arry<T>*> &y, const std::vector<std::array<unsigned, 4>> &id)
+{
+    unsigned nx = 0, ny = 0;
+    for(const auto &it: x) nx = std::max(nx, unsigned(it->size()));
+    for(const auto &it: y) ny = std::max(ny, unsigned(it->size()));
+
+    auto length = [](const Arry<T> &a, const Arry<T> &b)->unsigned {
+        return (a.empty() || b.empty()) ? 0 : a.size() + b.size() - 1; };
+
+    std::vector<unsigned> len(id.size());
+    for(unsigned o=0; o<id.size(); ++o)
+        len[o] = std::max(length(*x[id[o][0]], *y[id[o][1]]),
+                          length(*x[id[o][2]], *y[id[o][3]]));
+
+    std::vector<Arry<T>> r(id.size());
+
+    if ((nx == 0) || (ny == 0) || (! fft::use_fft(nx, ny)))
+    {
+        for(unsigned o=0; o<id.size(); ++o)
+        {
+            const Arry<T> p = schoolbook(*x[id[o][0]], *y[id[o][1]]),
+                          q = schoolbook(*x[id[o][2]], *y[id[o][3]]);
+            r[o].assign(len[o], T(0));
+            for(unsigned k=0; k<p.size(); ++k) r[o][k] += p[k];
+            for(unsigned k=0; k<q.size(); ++k) r[o][k] += q[k];
+        }
+        return r;
+    }
+
+    unsigned n = 1;
+    while (n < nx + ny - 1) n <<= 1;
+
+    std::vector<const Arry<T>*> xy(x);
+    xy.insert(xy.end(), y.begin(), y.end());
+
+    std::vector<CArry> S, R(id.size(), CArry(n));
+    forward(xy, n, S);
+
+    const unsigned oy = x.size();
+    for(unsigned o=0; o<id.size(); ++o)
+        for(unsigned k=0; k<n; ++k)
+            R[o][k] = S[id[o][0]][k] * S[oy+id[o][1]][k] + S[id[o][2]][k] * S[oy+id[o][3]][k];
+
+    backward(R, len, r);
+    return r;
+}
+
+// p with its lowest k coefficients dropped, i.e., p div x^k
+template <typename T>
+Arry<T> high_part(const Arry<T> &p, const unsigned k)
+{ return Arry<T>(p.begin() + k, p.end()); }
+
+// 2x2 polynomial matrix [[a, b], [c, d]]
+template <typename T>
+struct Mat
+{
+    Arry<T> a, b, c, d;
+
+    Mat(): a(1, T(1)), d(1, T(1)) {}
+
+    Mat operator*(const Mat &M) const
+    {
+        const std::vector<Arry<T>> r = sums_of_products<T>({&a, &b, &c, &d},
+                {&M.a, &M.b, &M.c, &M.d}, {{{0, 0, 1, 2}}, {{0, 1, 1, 3}},
+                {{2, 0, 3, 2}}, {{2, 1, 3, 3}}});
+
+        Mat P;
+        P.a = r[0]; P.b = r[1]; P.c = r[2]; P.d = r[3];
+        return P;
+    }
+};
+
+// (C, D) = M (A, B), cut to lc and ld coefficients. The dropped coefficients
+// vanish in exact arithmetic, so they measure the cancellation error, which
+// must stay below guard relative to what is kept.
+template <typename T>
+bool apply(const Mat<T> &M, const Arry<T> &A, const Arry<T> &B,
+        const unsigned lc, const unsigned ld, Arry<T> &C, Arry<T> &D,
+        const double guard)
+{
+    auto cut = [guard](Arry<T> &p, const unsigned len)->bool {
+        if (p.size() < len) return false;
+        const double err = maxabs(p.data() + len, p.size() - len);
+        p.resize(len);
+        return err <= guard * maxabs(p);
+    };
+
+    std::vector<Arry<T>> r = sums_of_products<T>({&M.a, &M.b, &M.c, &M.d},
+            {&A, &B}, {{{0, 0, 1, 1}}, {{2, 0, 3, 1}}});
+
+    C.swap(r[0]);
+    D.swap(r[1]);
+
+    return cut(C, lc) && cut(D, ld);
+}
+
+// one remainder step (A, B) <- (B, (A mod B) / lc) and M <- Q M; false, with
+// nothing changed, when the remainder is too close to zero for the step to be
+// trusted
+template <typename T>
+bool remainder_step(Arry<T> &A, Arry<T> &B, Mat<T> &M, const double guard)
+{
+    Arry<T> q(A.size() - B.size() + 1), r(A);
+    for(unsigned qi=q.size(); qi-->0; )
+    {
+        q[qi] = r[qi+B.size()-1] / B.back();
+        for(unsigned j=0; j<B.size(); ++j) r[qi+j] -= B[j] * q[qi];
+    }
+    r.resize(B.size() - 1);
+
+    if (r.empty() || (std::abs(r.back()) < guard * maxabs(B))) return false;
+
+    // Q = [[0, 1], [1/l, -q/l]]
+    const T l = r.back();
+    for(auto &it: r) it /= l;
+    for(auto &it: q) it = - it / l;
+
+    Arry<T> c = schoolbook(q, M.c), d = schoolbook(q, M.d);
+    c.resize(std::max(c.size(), M.a.size()), T(0));
+    d.resize(std::max(d.size(), M.b.size()), T(0));
+    for(unsigned k=0; k<M.a.size(); ++k) c[k] += M.a[k] / l;
+    for(unsigned k=0; k<M.b.size(); ++k) d[k] += M.b[k] / l;
+
+    M.a.swap(M.c); M.b.swap(M.d);
+    M.c.swap(c); M.d.swap(d);
+
+    A.swap(B);
+    B.swap(r);
+    return true;
+}
+
+// half GCD: the remainder steps M that take (A, B), deg A > deg B, to
+// (C, D) = M (A, B) with deg C >= m > deg D, m = ceil(deg A / 2); lc and ld
+// return the lengths of C and D. Every step drops the degree by one. A step
+// whose remainder has a relative leading coefficient below guard, or a
+// product with cancellation errors above it, stops the recursion early: the
+// return is then false, and M, lc and ld hold the steps taken so far.
+template <typename T>
+bool hgcd(const Arry<T> &A, const Arry<T> &B, Mat<T> &M,
+        unsigned &lc, unsigned &ld, const double guard)
+{
+    const unsigned n = A.size() - 1, m = (n + 1) / 2;
+
+    M = Mat<T>();
+    lc = A.size();
+    ld = B.size();
+
+    if (B.size() <= m) return true;
+
+    if (n < hgcd_base)
+    {
+        Arry<T> C(A), D(B);
+        bool done = true;
+        while (done && (D.size() > m)) done = remainder_step(C, D, M, guard);
+        lc = C.size();
+        ld = D.size();
+        return done;
+    }
+
+    // the top halves of A and B have the same first quotients
+    unsigned l0, l1;
+    bool done = hgcd(high_part(A, m), high_part(B, m), M, l0, l1, guard);
+
+    lc = l0 + m;
+    ld = l1 + m;
+    if ((! done) || (ld <= m)) return done;
+
+    // one more step and a second half GCD need (C, D) from x^j up only, and
+    // M takes those from A and B from x^(j - deg M) up
+    const unsigned k = 2 * m - (ld - 1), j = k - std::min(k, lc - ld);
+    const unsigned dm = std::max(std::max(M.a.size(), M.b.size()),
+                                 std::max(M.c.size(), M.d.size())) - 1;
+    const unsigned s = j - std::min(j, dm);
+
+    Arry<T> C, D;
+    if (! apply(M, high_part(A, s), high_part(B, s), lc - s, ld - s, C, D, guard))
+        return false;
+
+    C = high_part(C, j - s);
+    D = high_part(D, j - s);
+    if (! remainder_step(C, D, M, guard)) return false;
+
+    lc = ld;
+    ld = ld - 1;
+    if (ld <= m) return true;
+
+    // and again on the top of the new pair
+    Mat<T> S;
+    done = hgcd(high_part(C, k - j), high_part(D, k - j), S, l0, l1, guard);
+
+    M = S * M;
+    lc = l0 + k;
+    ld = l1 + k;
+
+    return done;
+}
+
+} // end of anonymous namespace
+
+
 // GCD
 template <typename T>
 Arry<T> GCD(const Arry<T> &p1, const Arry<T> &p2, const double tol)
@@ -200,33 +521,99 @@ Arry<T> GCD(const Arry<T> &p1, const Arry<T> &p2, const double tol)
     CHECK_COEFS(p1, 1e-12);
     CHECK_COEFS(p2, 1e-12);
 
-    Arry<T> a, b, q, r;
-    double delta;
-
-    a = p1;
-    b = divide(p2, p2.back());
-    auto f = [](const double &x, const T &y)->double{return x+std::norm(y);};
+    // special case. Note we use exactly zero here.
+    if (std::abs(p2.back()) == 0.0) throw exceptions::DivideByZero(__FL__);
+
+    // the remainder sequence runs in place on two buffers that swap roles;
+    // a is replaced by the remainder of a / b, which is then normalized and
+    // becomes the next b
+    const unsigned cap = std::max(p1.size(), p2.size());
+    Arry<T> buf(2 * cap);
+    T *a = buf.data(), *b = a + cap;
+    unsigned la = p1.size(), lb = p2.size();
+
+    std::copy(p1.begin(), p1.end(), a);
+    for(unsigned k=0; k<lb; ++k) b[k] = p2[k] / p2.back();
+
+    auto norm2 = [](const T *p, const unsigned len)->double {
+        double s = 0.0;
+        for(unsigned k=0; k<len; ++k) s += std::norm(p[k]);
+        return s;
+    };
+
+    // the half GCD only takes steps whose remainders are far from the tol
+    // test (see hgcd); where it stops, the step-wise sequence below takes
+    // over until the divisor is shorter than `fast`
+    const double guard = std::sqrt(tol);
+    unsigned fast = lb;
 
     int iter = 1;
     while(true)
     {
-        q = divide(a, b, r);
-        trim_leading_zeros(r, 1e-12);
-
-        delta = std::sqrt(
-                std::accumulate(std::begin(r), std::end(r), 0.0, f) /
-                std::accumulate(std::begin(b), std::end(b), 0.0, f));
+        if ((lb > hgcd_cutoff) && (lb <= fast) && (la > lb))
+        {
+            const Arry<T> A(a, a+la), B(b, b+lb);
+            Mat<T> M;
+            Arry<T> C, D;
+            unsigned lc, ld;
+
+            const bool done = hgcd(A, B, M, lc, ld, guard);
+            const bool moved = (ld < lb) && apply(M, A, B, lc, ld, C, D, guard);
+
+            if (moved)
+            {
+                for(unsigned k=0; k<C.size(); ++k) a[k] = C[k] / C.back();
+                for(unsigned k=0; k<D.size(); ++k) b[k] = D[k] / D.back();
+                iter += lb - ld;
+                la = lc;
+                lb = ld;
+            }
+
+            // past a stop or a failed product, the next steps go one by one
+            fast = (done && moved) ? ld : ld - 1;
+        }
+
+        // remainder of a / b in a[0, lr)
+        unsigned lr = la;
+        if (lb == 1) // b = constant
+        {
+            a[0] = 0.0;
+            lr = 1;
+        }
+        else if (la >= lb) // otherwise the remainder is a itself
+        {
+            for(unsigned qi=la-lb+1; qi-->0; )
+            {
+                const T q = a[qi+lb-1] / b[lb-1];
+                for(unsigned j=0; j<lb; ++j) a[qi+j] -= b[j] * q;
+            }
+            lr = lb - 1;
+        }
+
+        // trim leading zeros
+        while ((lr > 1) && (std::abs(a[lr-1]) < 1e-12)) lr -= 1;
+
+        const double delta = std::sqrt(norm2(a, lr) / norm2(b, lb));
 
         if (delta < tol) break;
 
-        a = b;
-        b = divide(r, r.back());
+        if (std::abs(a[lr-1]) == 0.0) throw exceptions::DivideByZero(__FL__);
+
+        const T lead = a[lr-1];
+        for(unsigned k=0; k<lr; ++k) a[k] /= lead;
+
+        std::swap(a, b);
+        la = lb;
+        lb = lr;
 
         iter += 1;
         if (iter > 10000) throw exceptions::InfLoop(__FILE__, __LINE__);
     }
 
-    return b;
+    SIMPOLY_STATS(s, s->gcd_steps = iter;
+            s->limit_ratio = std::max(s->limit_ratio, iter / 10000.0));
+
+    return Arry<T>(b, b+lb);
 }
 
 // trim leading zero coefficients
@@ -241,6 +628,160 @@ void trim_leading_zeros(Arry<T> &p, const double tol)
 }
 
 
+// in-place synthetic division by (x - r)
+template <typename T>
+T synthetic_division(Arry<T> &p, const T &r)
+{
+    CHECK_COEFS(p, 1e-12);
+
+    // constant polynomial: zero quotient
+    if (p.size() == 1) { const T rem = p[0]; p[0] = 0.0; return rem; }
+
+    // Horner's scheme; the running value before adding p[k] is q[k]
+    T acc = p.back();
+    for(unsigned k=p.size()-1; k-->0; )
+    {
+        const T a = p[k];
+        p[k] = acc;
+        acc = acc * r + a;
+    }
+
+    p.pop_back();
+    return acc;
+}
+
+// in-place synthetic division by x^2 + b x + c
+template <typename T>
+void synthetic_division(Arry<T> &p, const T &b, const T &c, T &r1, T &r0)
+{
+    CHECK_COEFS(p, 1e-12);
+
+    const unsigned n = p.size() - 1;
+
+    // degree lower than 2: zero quotient
+    if (n < 2)
+    {
+        r1 = (n == 1) ? p[1] : T(0.0);
+        r0 = p[0];
+        p.assign(1, 0.0);
+        return;
+    }
+
+    // q[k-2] replaces p[k], which is not needed any more
+    T q1 = 0.0, q2 = 0.0; // q[k-1] and q[k]
+    for(unsigned k=n; k>=2; --k)
+    {
+        const T q = p[k] - b * q1 - c * q2;
+        p[k] = q;
+        q2 = q1;
+        q1 = q;
+    }
+
+    r1 = p[1] - b * q1 - c * q2;
+    r0 = p[0] - c * q1;
+
+    p.erase(p.begin(), p.begin()+2);
+}
+
+namespace
+{
+
+// factor x^o + b x + c (o = 1: x + b) and its recent outputs
+template <typename T>
+struct Stage
+{
+    unsigned o;
+    T b, c, s1, s2;
+};
+
+// divide p by all factors in one sweep from the leading coefficient: stage j
+// consumes the quotient stream of stage j-1 as soon as it is produced
+template <typename T>
+void pipelined_division(Arry<T> &p, std::vector<Stage<T>> &stages)
+{
+    const unsigned len = p.size();
+
+    unsigned D = 0; // total degree of the factors
+    for(const auto &it: stages) D += it.o;
+
+    if (D >= len) throw exceptions::PolynomialErrorGeneral(__FL__,
+            "Deflating more roots than the degree of the polynomial.");
+
+    for(unsigned t=0; t<len-D; ++t)
+    {
+        T v = p[len-1-t];
+
+        for(auto &st: stages)
+        {
+            const T out = v - st.b * st.s1 - st.c * st.s2;
+            st.s2 = st.s1;
+            st.s1 = out;
+            v = out;
+        }
+
+        // the final quotient is top-aligned for now
+        p[len-1-t] = v;
+    }
+
+    p.erase(p.begin(), p.begin()+D);
+}
+
+} // end of anonymous namespace
+
+// deflate many roots in one sweep
+template <typename T>
+void deflate(Arry<T> &p, const Arry<T> &roots)
+{
+    CHECK_COEFS(p, 1e-12);
+
+    // small roots first keeps forward deflation stable
+    std::vector<Stage<T>> stages;
+    stages.reserve(roots.size());
+    for(const auto &r: roots) stages.push_back({1, -r, 0.0, 0.0, 0.0});
+
+    std::sort(stages.begin(), stages.end(),
+            [](const Stage<T> &x, const Stage<T> &y) { return std::abs(x.b) < std::abs(y.b); });
+
+    pipelined_division(p, stages);
+}
+
+// deflate real roots and conjugate pairs in one sweep
+void deflate(DArry &p, const DArry &rroots, const CArry &croots)
+{
+    CHECK_COEFS(p, 1e-12);
+
+    std::vector<Stage<double>> stages;
+    stages.reserve(rroots.size() + croots.size());
+
+    for(const auto &r: rroots) stages.push_back({1, -r, 0.0, 0.0, 0.0});
+
+    // each pair gives a real quadratic factor x^2 - 2 Re(z) x + |z|^2
+    int balance = 0;
+    for(const auto &z: croots)
+    {
+        if (z.imag() == 0.0) stages.push_back({1, -z.real(), 0.0, 0.0, 0.0});
+        else if (z.imag() < 0.0) balance -= 1;
+        else
+        {
+            balance += 1;
+            stages.push_back({2, -2.0 * z.real(), std::norm(z), 0.0, 0.0});
+        }
+    }
+
+    if (balance != 0) throw exceptions::PolynomialErrorGeneral(__FL__,
+            "Complex roots of a real polynomial must come in conjugate pairs.");
+
+    // small roots first keeps forward deflation stable; |c| = |z|^2 for pairs
+    auto modulus = [](const Stage<double> &x)->double {
+        return (x.o == 1) ? std::abs(x.b) : std::sqrt(x.c); };
+    std::sort(stages.begin(), stages.end(),
+            [&modulus](const Stage<double> &x, const Stage<double> &y) {
+                return modulus(x) < modulus(y); });
+
+    pipelined_division(p, stages);
+}
+
+
 // find polynomial coefficients from roots
 template <typename T>
 Arry<T> to_coefficients(const T &l, const T* const &rts, const int len)
@@ -295,11 +836,41 @@ template CArry GCD(const CArry &p1, const CArry &p2, const double tol);
 template void trim_leading_zeros(DArry &p, const double tol);
 template void trim_leading_zeros(CArry &p, const double tol);
 
+template double synthetic_division(DArry &p, const double &r);
+template Cmplx synthetic_division(CArry &p, const Cmplx &r);
+template void synthetic_division(DArry &p, const double &b, const double &c,
+        double &r1, double &r0);
+template void synthetic_division(CArry &p, const Cmplx &b, const Cmplx &c,
+        Cmplx &r1, Cmplx &r0);
+
+template void deflate(DArry &p, const DArry &roots);
+template void deflate(CArry &p, const CArry &roots);
+
 template DArry to_coefficients(const double &l, const double* const &rts, const int len);
 template CArry to_coefficients(const Cmplx &l, const Cmplx* const &rts, const int len);
 template DArry to_coefficients(const double &l, const DArry &rts);
 template CArry to_coefficients(const Cmplx &l, const CArry &rts);
 
+template FArry add(const FArry &p1, const FArry &p2);
+template FArry add(const FArry &p, const float &c);
+template FArry substract(const FArry &p1, const FArry &p2);
+template FArry substract(const FArry &p, const float &c);
+template FArry multiply(const FArry &p1, const FArry &p2);
+template FArry multiply(const FArry &p, const float &c);
+template FArry divide(const FArry &p1, const FArry &p2, FArry &r);
+template FArry divide(const FArry &p, const float &c);
+template void trim_leading_zeros(FArry &p, const double tol);
+
+template LArry add(const LArry &p1, const LArry &p2);
+template LArry add(const LArry &p, const long double &c);
+template LArry substract(const LArry &p1, const LArry &p2);
+template LArry substract(const LArry &p, const long double &c);
+template LArry multiply(const LArry &p1, const LArry &p2);
+template LArry multiply(const LArry &p, const long double &c);
+template LArry divide(const LArry &p1, const LArry &p2, LArry &r);
+template LArry divide(const LArry &p, const long double &c);
+template void trim_leading_zeros(LArry &p, const double tol);
+
 
 // operator << for DArry
 std::ostream &operator<<(std::ostream &os, const simpoly::basic::DArry &v)
@@ -9,10 +9,14 @@
 
 # include <algorithm>
 # include <numeric>
+# include <limits>
 # include <cmath>
+# include <chrono>
 
 # include "basic.h"
 # include "exceptions.h"
+# include "../parallel.h"
+# include "../stats.h"
 
 
 namespace simpoly
@@ -31,6 +35,103 @@ CArry low_degree_roots2(const CArry &P)
     return {(-P[1]+sqFourAC)/twoA, (-P[1]-sqFourAC)/twoA};
 }
 
+// roots of the monic quadratic z^2 + B z + C without cancellation
+void monic_quadratic(const Cmplx &B, const Cmplx &C, Cmplx &z1, Cmplx &z2)
+{
+    Cmplx D = std::sqrt(B * B - 4.0 * C);
+    if (std::real(std::conj(B) * D) < 0.0) D = -D;
+
+    z1 = -0.5 * (B + D);
+    z2 = (z1 == 0.0) ? Cmplx(0.0) : C / z1;
+}
+
+// a few Newton steps, kept only when they reduce the residual
+void polish_low_degree(const CArry &P, CArry &rts)
+{
+    for(auto &z: rts)
+        for(unsigned k=0; k<2; ++k)
+        {
+            Cmplx d, v = evaluate_with_derivative(P, z, d);
+            if ((v == 0.0) || (d == 0.0)) break;
+
+            const Cmplx zn = z - v / d;
+            if (std::abs(evaluate(P, zn)) >= std::abs(v)) break;
+            z = zn;
+        }
+}
+
+CArry low_degree_roots3(const CArry &P)
+{
+    // monic form x^3 + a x^2 + b x + c, then depressed form y^3 + p y + q
+    const Cmplx a = P[2] / P[3], b = P[1] / P[3], c = P[0] / P[3];
+    const Cmplx a3 = a / 3.0;
+    const Cmplx p = b - a * a3, q = c + a3 * (2.0 * a3 * a3 - b);
+
+    // Cardano's formula; the sign of D avoids cancellation in u^3
+    Cmplx D = std::sqrt(0.25 * q * q + p * p * p / 27.0);
+    if (std::real(std::conj(q) * D) < 0.0) D = -D;
+
+    const Cmplx u3 = -0.5 * q - D;
+    const Cmplx u = (u3 == 0.0) ? Cmplx(0.0) : std::pow(u3, 1.0/3.0);
+    const Cmplx v = (u == 0.0) ? Cmplx(0.0) : -p / (3.0 * u);
+    const Cmplx w(-0.5, 0.5 * std::sqrt(3.0)); // a cubic root of unity
+
+    CArry rts({u + v - a3, w * u + std::conj(w) * v - a3,
+            std::conj(w) * u + w * v - a3});
+
+    polish_low_degree(P, rts);
+    return rts;
+}
+
+CArry low_degree_roots4(const CArry &P)
+{
+    // when the product of roots is large, the shift a/4 below swamps small
+    // roots; solve for reciprocal roots instead
+    if (std::abs(P[0]) > std::abs(P[4]))
+    {
+        CArry rts = low_degree_roots4({P[4], P[3], P[2], P[1], P[0]});
+        for(auto &it: rts) it = 1.0 / it;
+
+        polish_low_degree(P, rts);
+        return rts;
+    }
+
+    // monic form x^4 + a x^3 + b x^2 + c x + d, then y^4 + p y^2 + q y + r
+    const Cmplx a = P[3] / P[4], b = P[2] / P[4], c = P[1] / P[4], d = P[0] / P[4];
+    const Cmplx a4 = a / 4.0;
+    const Cmplx p = b - 6.0 * a4 * a4,
+                q = c - 2.0 * a4 * b + 8.0 * a4 * a4 * a4,
+                r = d - a4 * c + a4 * a4 * b - 3.0 * a4 * a4 * a4 * a4;
+
+    // Ferrari: a root m of the resolvent cubic splits the quartic into
+    // (y^2 - s y + p/2 + m + q/(2s)) (y^2 + s y + p/2 + m - q/(2s)), s^2 = 2m
+    CArry res = low_degree_roots3({-0.125 * q * q, 0.25 * p * p - r, p, 1.0});
+
+    Cmplx m = res[0];
+    for(const auto &it: res) if (std::abs(it) > std::abs(m)) m = it;
+
+    CArry rts(4);
+
+    if (m == 0.0) // biquadratic
+    {
+        Cmplx z1, z2;
+        monic_quadratic(p, r, z1, z2);
+        rts[0] = std::sqrt(z1); rts[1] = -rts[0];
+        rts[2] = std::sqrt(z2); rts[3] = -rts[2];
+    }
+    else
+    {
+        const Cmplx s = std::sqrt(2.0 * m), h = 0.5 * p + m, g = 0.5 * q / s;
+        monic_quadratic(-s, h + g, rts[0], rts[1]);
+        monic_quadratic(s, h - g, rts[2], rts[3]);
+    }
+
+    for(auto &it: rts) it -= a4;
+
+    polish_low_degree(P, rts);
+    return rts;
+}
+
 CArry use_low_degree_formula(const CArry &P)
 {
     switch (P.size())
@@ -44,25 +145,128 @@ CArry use_low_degree_formula(const CArry &P)
         case 3: // degree 2 (i.e., quadratic)
             return low_degree_roots2(P);
             break;
-        case 4: // degree 2 (i.e., cubic)
-        case 5: // degree 2 (i.e., quartic)
+        case 4: // degree 3 (i.e., cubic)
+            return low_degree_roots3(P);
+            break;
+        case 5: // degree 4 (i.e., quartic)
+            return low_degree_roots4(P);
+            break;
        default:
            throw exceptions::PolynomialErrorGeneral(
                    __FL__, "Not implemented yet.");
    }
 }
 
+void initial_guess(const unsigned len, const double *mag,
+        double *zr, double *zi, double *lg, unsigned *iwork)
+{
+    const int n = len - 1; // degree
+    unsigned *idx = iwork, *hull = iwork + len;
+
+    // points (i, log|a_i|) of non-zero coefficients
+    unsigned np = 0;
+    for(int i=0; i<=n; ++i)
+        if (mag[i] != 0.0)
+        {
+            idx[np] = i;
+            lg[np] = std::log(mag[i]);
+            np += 1;
+        }
+
+    // upper convex hull with monotone chain; `hull` holds positions in idx
+    unsigned nh = 0;
+    for(unsigned k=0; k<np; ++k)
+    {
+        while (nh > 1)
+        {
+            const unsigned &a = hull[nh-2], &b = hull[nh-1];
+
+            // pop b if it is not above the segment from a to k
+            double cross = (double(idx[b]) - idx[a]) * (lg[k] - lg[a]) -
+                           (lg[b] - lg[a]) * (double(idx[k]) - idx[a]);
+
+            if (cross >= 0.0) nh -= 1;
+            else break;
+        }
+        hull[nh++] = k;
+    }
+
+    const double twopi = 2.0 * std::acos(-1.0);
+    const double sigma = 0.7; // offset keeping guesses off the real axis
+
+    double rmin = std::numeric_limits<double>::max();
+    unsigned g = 0;
+
+    for(unsigned h=1; h<nh; ++h)
+    {
+        const unsigned &a = hull[h-1], &b = hull[h];
+        const int m = idx[b] - idx[a];
+
+        // modulus of the m roots associated with this edge
+        const double r = std::exp((lg[a] - lg[b]) / m);
+        rmin = std::min(rmin, r);
+
+        for(int i=0; i<m; ++i, ++g)
+        {
+            const double t = twopi * i / m + twopi * idx[b] / n + sigma;
+            zr[g] = r * std::cos(t);
+            zi[g] = r * std::sin(t);
+        }
+    }
+
+    // roots at the origin: a_0 = ... = a_{k-1} = 0
+    const int k = idx[0];
+    const double r0 = (nh > 1) ? 1e-3 * rmin : 1e-3;
+    for(int i=0; i<k; ++i, ++g)
+    {
+        zr[g] = r0 * std::cos(twopi * i / k + sigma);
+        zi[g] = r0 * std::sin(twopi * i / k + sigma);
+    }
+}
+
+
+CArry initial_guess(const CArry &coeffs)
+{
+    CHECK_COEFS(coeffs, 1e-12);
+
+    const unsigned len = coeffs.size(), n = len - 1;
+
+    DArry mag(len), lg(len), zr(n), zi(n);
+    std::vector<unsigned> iwork(2*len);
+    for(unsigned i=0; i<len; ++i) mag[i] = std::abs(coeffs[i]);
+
+    initial_guess(len, mag.data(), zr.data(), zi.data(), lg.data(), iwork.data());
+
+    CArry guess(n);
+    for(unsigned i=0; i<n; ++i) guess[i] = Cmplx(zr[i], zi[i]);
+
+    return guess;
+}
+
+
+CArry initial_guess(const DArry &coeffs)
+{
+    CHECK_COEFS(coeffs, 1e-12);
+
+    return initial_guess(to_CArry(coeffs));
+}
+
+
 template <typename T>
-T newton_raphson(const Arry<T> &coeffs, const T guess, const double tol)
+T newton_raphson(const Arry<T> &coeffs, const T guess, const double tol,
+        const Accuracy accuracy)
 {
     CHECK_COEFS(coeffs, 1e-12);
 
     T ans = guess;
     Arry<T> d = derivative(coeffs);
 
-    for(unsigned iter=0; iter<10000; ++iter)
+    unsigned iter = 0;
+    for(; iter<10000; ++iter)
     {
-        T value = evaluate(coeffs, ans),
+        SIMPOLY_STATS(s, s->iterations += 1; s->evaluations += 2);
+
+        T value = evaluate(coeffs, ans, accuracy),
           d_value = evaluate(d, ans),
           diff;
 
@@ -71,7 +275,7 @@ T newton_raphson(const Arry<T> &coeffs, const T guess, const double tol)
         if (d_value == 0.0) // to avoid devide by zero
         {
             ans *= 1.0001;
-            value = evaluate(coeffs, ans);
+            value = evaluate(coeffs, ans, accuracy);
             d_value = evaluate(d, ans);
         }
         diff = value / d_value;
@@ -80,81 +284,144 @@ T newton_raphson(const Arry<T> &coeffs, const T guess, const double tol)
         if (iter > 10000) throw exceptions::InfLoop(__FILE__, __LINE__);
     }
 
+    SIMPOLY_STATS(s, s->limit_ratio = std::max(s->limit_ratio, iter / 10000.0));
+
+    if (accuracy == Accuracy::COMPENSATED) ans = polish(coeffs, ans);
+
     return ans;
 }
 
 
-CArry aberth(const CArry &coeffs, const CArry &guess, const double tol)
+namespace
 {
-    CHECK_COEFS(coeffs, 1e-12);
 
-# ifdef NDEBUG
-    if (guess.size() == 0) throw exceptions::PolynomialErrorGeneral(
-            __FL__, "The length of initial guess can not be zero.");
-# endif
+// running error bound of Horner's scheme at z (Higham, Accuracy and Stability
+// of Numerical Algorithms, Sec. 5.1); once |p(z)| falls below it, z can not
+// be improved any further (Bini's stopping criterion). The a priori bound
+// 4 len eps sum |a_k| |z|^k is too pessimistic to stop a Newton-like
+// iteration with, as it lies far above the actual errors of most evaluations.
+inline double rounding_level(const CArry &coeffs, const Cmplx &z)
+{
+    const unsigned len = coeffs.size();
+    const double az = std::abs(z);
 
-    // alias to the length of provided coefficient array
-    const auto &len = coeffs.size();
+    Cmplx p = coeffs[len-1];
+    double mu = 0.5 * std::abs(p);
 
-    // use exact solution for low-degree polynomials
-    if (len < 4) return use_low_degree_formula(coeffs);
+    for(unsigned k=len-1; k-->0; )
+    {
+        p = p * z + coeffs[k];
+        mu = mu * az + std::abs(p);
+    }
 
-    // initialize initial guess through copying
-    CArry rts(guess);
+    return 2.0 * std::sqrt(2.0) * std::numeric_limits<double>::epsilon() *
+        (2.0 * mu - std::abs(p));
+}
 
-    // create a vector indicating if each root has been found
-    std::vector<bool> stop(guess.size(), false);
+} // end of anonymous namespace
 
-    // derivative
-    CArry d = derivative(coeffs);
+
+// Aberth sweeps over the roots listed in `active`; other roots stay frozen
+void aberth_active_set(const CArry &coeffs, CArry &rts,
+        std::vector<unsigned> &active, std::vector<unsigned> &iters,
+        const double tol)
+{
+    const unsigned n = rts.size();
 
     // an index to record the number of while iteration
     long iter = 0;
 
-    while (std::any_of(stop.begin(), stop.end(), [](bool b){return !b;}))
+    while (! active.empty())
     {
-        for(unsigned int i=0; i<guess.size(); ++i)
+        iter += 1;
+        if (iter > 10000) throw exceptions::InfLoop(__FILE__, __LINE__);
+
+        SIMPOLY_STATS(s, s->iterations += 1; s->evaluations += active.size());
+
+        unsigned n_active = 0;
+        for(const auto &i: active)
         {
-            const Cmplx &zi = rts[i]; // alias
-            Cmplx temp, delta;
+            const Cmplx zi = rts[i];
+            Cmplx d, value, delta(0.0, 0.0);
 
-            temp = evaluate(coeffs, zi) / evaluate(d, zi);
+            value = evaluate_with_derivative(coeffs, zi, d);
 
-            delta = std::accumulate(
-                rts.begin(), rts.begin()+i, Cmplx(0.0, 0.0),
-                [&zi] (const Cmplx &x, const Cmplx &y) -> Cmplx
-                    { return x + 1.0 / (zi - y); });
+            // a value at the rounding level takes its last correction
+            const bool stalled = (std::abs(value) <= rounding_level(coeffs, zi));
 
-            delta += std::accumulate(
-                rts.begin()+i+1, rts.end(), Cmplx(0.0, 0.0),
-                [&zi] (const Cmplx &x, const Cmplx &y) -> Cmplx
-                    { return x + 1.0 / (zi - y); });
+            // exact zero (note we use exact 0.0 here) needs no correction
+            if (value != 0.0)
+            {
+                // frozen roots still contribute to the pairwise sum
+                for(unsigned j=0; j<i; ++j) delta += 1.0 / (zi - rts[j]);
+                for(unsigned j=i+1; j<n; ++j) delta += 1.0 / (zi - rts[j]);
 
-            delta *= temp;
-            delta = 1.0 - delta;
-            delta = temp / delta;
+                const Cmplx temp = value / d;
+                delta = temp / (1.0 - temp * delta);
+            }
 
-            if ((std::abs(delta)/std::abs(rts[i])) < tol) stop[i] = true;
+            if (stalled || (std::abs(delta) <= tol * std::abs(zi))) iters[i] = iter;
+            else active[n_active++] = i; // compact the active set in place
 
             rts[i] -= delta;
-            if (evaluate(coeffs, rts[i]) == 0.0) stop[i] = true; // exact zero
         }
 
-        // check the number of iterations
-        iter += 1;
-        if (iter > 10000) throw exceptions::InfLoop(__FILE__, __LINE__);
+        active.resize(n_active);
     }
 
+    SIMPOLY_STATS(s, s->sweeps = iters;
+            s->limit_ratio = std::max(s->limit_ratio, iter / 10000.0));
+}
+
+
+CArry aberth(const CArry &coeffs, const CArry &guess,
+        std::vector<unsigned> &iters, const double tol)
+{
+    CHECK_COEFS(coeffs, 1e-12);
+
+# ifdef NDEBUG
+    if (guess.size() == 0) throw exceptions::PolynomialErrorGeneral(
+            __FL__, "The length of initial guess can not be zero.");
+# endif
+
+    // alias to the length of provided coefficient array
+    const auto &len = coeffs.size();
+
+    // use exact solution for low-degree polynomials
+    if (len < 6)
+    {
+        iters.assign(len-1, 0);
+        return use_low_degree_formula(coeffs);
+    }
+
+    // initialize initial guess through copying
+    CArry rts(guess);
+
+    // indices of roots that have not converged yet
+    std::vector<unsigned> active(rts.size());
+    std::iota(active.begin(), active.end(), 0);
+
+    iters.assign(rts.size(), 0);
+
+    aberth_active_set(coeffs, rts, active, iters, tol);
+
     return rts;
 }
 
 
+CArry aberth(const CArry &coeffs, const CArry &guess, const double tol)
+{
+    std::vector<unsigned> iters;
+    return aberth(coeffs, guess, iters, tol);
+}
+
+
 CArry aberth(const CArry &coeffs, const DArry &guess, const double tol)
 {
     CHECK_COEFS(coeffs, 1e-12);
 
     // use exact solution for low-degree polynomials
-    if (coeffs.size() < 4) return use_low_degree_formula(coeffs);
+    if (coeffs.size() < 6) return use_low_degree_formula(coeffs);
 
     // make a copy of guess with complex type, and perturbation in imag
     CArry G = to_CArry(guess);
@@ -171,7 +438,7 @@ CArry aberth(const DArry &coeffs, const CArry &guess, const double tol)
     CHECK_COEFS(coeffs, 1e-12);
 
     // use exact solution for low-degree polynomials
-    if (coeffs.size() < 4) return use_low_degree_formula(to_CArry(coeffs));
+    if (coeffs.size() < 6) return use_low_degree_formula(to_CArry(coeffs));
 
     return aberth(to_CArry(coeffs), guess, tol);
 }
@@ -182,7 +449,7 @@ CArry aberth(const DArry &coeffs, const DArry &guess, const double tol)
     CHECK_COEFS(coeffs, 1e-12);
 
     // use exact solution for low-degree polynomials
-    if (coeffs.size() < 4) return use_low_degree_formula(to_CArry(coeffs));
+    if (coeffs.size() < 6) return use_low_degree_formula(to_CArry(coeffs));
 
     // make a copy of guess with complex type
     CArry G = to_CArry(guess);
@@ -199,16 +466,9 @@ CArry aberth(const CArry &coeffs, const double tol)
     CHECK_COEFS(coeffs, 1e-12);
 
     // use exact solution for low-degree polynomials
-    if (coeffs.size() < 4) return use_low_degree_formula(coeffs);
-
-    // initialize initial guess through copying
-    CArry guess(coeffs.size()-1);
-
-    const auto &bg = guess.data();
-    std::for_each(guess.begin(), guess.end(),
-        [&bg](Cmplx &x){x = std::pow(Cmplx(0.5, 0.5), double(&x-bg));});
+    if (coeffs.size() < 6) return use_low_degree_formula(coeffs);
 
-    return aberth(coeffs, guess, tol);
+    return aberth(coeffs, initial_guess(coeffs), tol);
 }
 
 
@@ -217,97 +477,273 @@ CArry aberth(const DArry &coeffs, const double tol)
     CHECK_COEFS(coeffs, 1e-12);
 
     // use exact solution for low-degree polynomials
-    if (coeffs.size() < 4) return use_low_degree_formula(to_CArry(coeffs));
+    if (coeffs.size() < 6) return use_low_degree_formula(to_CArry(coeffs));
 
-    // initialize initial guess through copying
-    CArry guess(coeffs.size()-1);
+    CArry C = to_CArry(coeffs);
+    return aberth(C, initial_guess(C), tol);
+}
+
+
+namespace
+{
+
+typedef std::chrono::steady_clock Clock;
+
+// seconds elapsed since t0; t0 moves to now
+inline double lap(Clock::time_point &t0)
+{
+    const Clock::time_point t1 = Clock::now();
+    const double dt = std::chrono::duration<double>(t1 - t0).count();
+    t0 = t1;
+    return dt;
+}
+
+// p(z) and p'(z) with one Horner pass over a raw coefficient array
+inline Cmplx horner(const Cmplx *c, const unsigned len, const Cmplx &z, Cmplx &d)
+{
+    Cmplx p = c[len-1];
+    d = 0.0;
+
+    for(unsigned k=len-1; k-->0; )
+    {
+        d = d * z + p;
+        p = p * z + c[k];
+    }
 
-    const auto &bg = guess.data();
-    std::for_each(guess.begin(), guess.end(),
-        [&bg](Cmplx &x){x = std::pow(Cmplx(0.5, 0.5), double(&x-bg));});
+    return p;
+}
 
-    return aberth(coeffs, guess, tol);
+// p(z) with Horner's scheme over a raw coefficient array
+inline Cmplx horner(const Cmplx *c, const unsigned len, const Cmplx &z)
+{
+    Cmplx p = c[len-1];
+    for(unsigned k=len-1; k-->0; ) p = p * z + c[k];
+    return p;
 }
 
+// derivative of c (len coefficients) into d (len-1 coefficients)
+inline void derivative_into(const Cmplx *c, const unsigned len, Cmplx *d)
+{
+    for(unsigned k=1; k<len; ++k) d[k-1] = double(k) * c[k];
+}
+
+// quotient of the exact division a / b into q (la - lb + 1 coefficients)
+// through back substitution; the remainder is neither needed nor stored
+inline void quotient_into(const Cmplx *a, const unsigned la,
+        const Cmplx *b, const unsigned lb, Cmplx *q)
+{
+    const unsigned lq = la - lb + 1;
+
+    for(unsigned k=lq; k-->0; )
+    {
+        Cmplx r = a[k+lb-1];
+        for(unsigned j=1; (j<lb) && (k+j<lq); ++j) r -= q[k+j] * b[lb-1-j];
+        q[k] = r / b[lb-1];
+    }
+}
 
-CArry yan_and_chieng_2006(const CArry &coeffs, const double tol)
+// Jacobi-style Aberth sweeps on the active roots; corrections of one sweep
+// only read roots of the previous sweep, so they are computed in parallel
+void refine_parallel(const CArry &coeffs, Cmplx *z, const unsigned n,
+        std::vector<unsigned> &active, Cmplx *delta,
+        const double tol, const unsigned nthreads)
+{
+    const unsigned len = coeffs.size();
+
+    // whether p(z) of each root is at the rounding level
+    std::vector<char> stalled(n, 0);
+
+    SIMPOLY_STATS(s, s->sweeps.assign(n, 0));
+
+    // the same threads serve all sweeps
+    parallel::Team team(parallel::n_workers(active.size(), nthreads));
+
+    for(long iter=1; ! active.empty(); ++iter)
+    {
+        if (iter > 10000) throw exceptions::InfLoop(__FILE__, __LINE__);
+
+        SIMPOLY_STATS(s, s->iterations += 1; s->evaluations += active.size();
+                s->limit_ratio = std::max(s->limit_ratio, iter / 10000.0));
+
+        team.for_range(active.size(), [&](unsigned bg, unsigned ed)
+        {
+            for(unsigned a=bg; a<ed; ++a)
+            {
+                const unsigned i = active[a];
+                const Cmplx zi = z[i];
+
+                Cmplx d, value = horner(coeffs.data(), len, zi, d), s(0.0, 0.0);
+
+                // a value at the rounding level takes its last correction
+                stalled[i] = (std::abs(value) <= rounding_level(coeffs, zi));
+
+                // exact zero (note we use exact 0.0 here) needs no correction
+                if (value == 0.0) { delta[i] = 0.0; continue; }
+
+                // frozen roots still contribute to the pairwise sum
+                for(unsigned j=0; j<i; ++j) s += 1.0 / (zi - z[j]);
+                for(unsigned j=i+1; j<n; ++j) s += 1.0 / (zi - z[j]);
+
+                const Cmplx temp = value / d;
+                delta[i] = temp / (1.0 - temp * s);
+            }
+        });
+
+        unsigned n_active = 0;
+        for(const auto &i: active)
+        {
+            if ((! stalled[i]) && (std::abs(delta[i]) > tol * std::abs(z[i])))
+                active[n_active++] = i;
+            else SIMPOLY_STATS(s, s->sweeps[i] = iter);
+            z[i] -= delta[i];
+        }
+
+        active.resize(n_active);
+    }
+}
+
+} // end of anonymous namespace
+
+
+CArry yan_and_chieng_2006(const CArry &coeffs, PhaseTimings &timings,
+        const double tol, const RootMethod method, const unsigned nthreads)
 {
     CHECK_COEFS(coeffs, 1e-12);
 
+    timings = PhaseTimings();
+    Clock::time_point t0 = Clock::now();
+
     // use exact solution for low-degree polynomials
-    if (coeffs.size() < 4) return use_low_degree_formula(coeffs);
+    if (coeffs.size() < 4)
+    {
+        CArry result = use_low_degree_formula(coeffs);
+        timings.simple = lap(t0);
+        return result;
+    }
+
+    const unsigned len = coeffs.size(), n = len - 1;
+
+    // approximated GCD of f and f'; f' stays in the arena below
+    CArry arena(6 * n);
+    Cmplx *drv = arena.data();
+    derivative_into(coeffs.data(), len, drv);
 
-    CArry     drv = derivative(coeffs); // direvative
-    CArry     agcd = GCD(coeffs, drv); // approximated GCD
-    CArry     q_coeffs = divide(coeffs, agcd); // f(x) / GCD
-    CArry     q_drv = divide(drv, agcd); // direvative / GCD
-    CArry     drv_q_coeffs = derivative(q_coeffs);
+    const CArry agcd = GCD(coeffs, CArry(drv, drv+n));
+    const unsigned lg = agcd.size();
+    timings.gcd = lap(t0);
+
+    // f / GCD is passed on to a root-finding engine, so it is the only array
+    // outside of the arena; f' / GCD and (f / GCD)' share the arena
+    const unsigned lq = len - lg + 1, m = lq - 1; // m: number of distinct roots
+    CArry q_coeffs(lq);
+    quotient_into(coeffs.data(), len, agcd.data(), lg, q_coeffs.data());
+
+    Cmplx *q_drv = drv + n, // f' / GCD, m coefficients
+          *simples2 = q_drv + n, *delta = simples2 + n, *fval = delta + n,
+          *fdrv = fval + n;
+    quotient_into(drv, n, agcd.data(), lg, q_drv);
+    timings.quotient = lap(t0);
 
     // simple roots from q_coeffs
-    CArry       simples1 = aberth(q_coeffs, tol);
+    const CArry simples1 = (method == RootMethod::COMPANION) ?
+        companion_roots(q_coeffs) : aberth(q_coeffs, tol);
+    timings.simple = lap(t0);
+
+    // multiplicities from (f'/GCD)(z) / (f/GCD)'(z); one fused pass gives the
+    // latter, and f(z), f'(z) at the unrefined roots for the selection below
+    std::vector<unsigned> mult(m);
+    unsigned total = 0;
+    for(unsigned i=0; i<m; ++i)
+    {
+        Cmplx dq;
+        horner(q_coeffs.data(), lq, simples1[i], dq);
+        mult[i] = std::max(int((horner(q_drv, m, simples1[i]) / dq).real() + 0.5), 1);
+        total += mult[i];
+
+        fval[i] = horner(coeffs.data(), len, simples1[i], fdrv[i]);
+    }
+    timings.multiplicity = lap(t0);
+
+    // multiplicities not adding up to the degree mean the approximate GCD is
+    // spurious, e.g., when rounded coefficients are too ill-conditioned for it;
+    // all roots of f are then taken as simple
+    if (total != n)
+    {
+        CArry result = (method == RootMethod::COMPANION) ?
+            companion_roots(coeffs) : aberth(coeffs, tol);
+        timings.refine = lap(t0);
 
-    // refine simple roots with original polynomial `coeffs`
-    CArry       simples2 = aberth(coeffs, simples1, tol);
+        SIMPOLY_STATS(s, s->evaluations += 3 * m; s->timings = timings);
+
+        return result;
+    }
+
+    // refine simple roots with original polynomial `coeffs`; multiple roots
+    // stay frozen because they can not converge to `tol` in double precision
+    std::copy(simples1.begin(), simples1.end(), simples2);
+    std::vector<unsigned> active;
+    for(unsigned i=0; i<m; ++i) if (mult[i] <= 1) active.push_back(i);
+    refine_parallel(coeffs, simples2, m, active, delta, tol, nthreads);
+    timings.refine = lap(t0);
 
     // an array for final results
-    CArry       result(coeffs.size() - 1);
+    CArry       result(n);
 
     unsigned k = 0; // index for result
-    for(unsigned i=0; i<simples1.size(); ++i)
+    for(unsigned i=0; i<m; ++i)
     {
-        // claculate multiplicity
-        unsigned m = int((evaluate(q_drv, simples1[i]) /
-                evaluate(drv_q_coeffs, simples1[i])).real() + 0.5);
+        // choose the better candidate: residuals of f, and of f' for
+        // multiple roots
+        Cmplx d2, v2 = horner(coeffs.data(), len, simples2[i], d2);
 
-        // choose the best one
-        if (m > 1)
-        {
-            double e1 = std::norm(evaluate(drv, simples1[i])) +
-                        std::norm(evaluate(coeffs, simples1[i])),
-                   e2 = std::norm(evaluate(drv, simples2[i])) +
-                        std::norm(evaluate(coeffs, simples2[i]));
+        const double e1 = std::norm(fval[i]) + ((mult[i] > 1) ? std::norm(fdrv[i]) : 0.0),
+                     e2 = std::norm(v2) + ((mult[i] > 1) ? std::norm(d2) : 0.0);
 
-            if (e1 < e2) result[k] = simples1[i];
-            else result[k] = simples2[i];
-            k += 1;
+        const Cmplx &z = (e1 < e2) ? simples1[i] : simples2[i];
 
-            // duplicate multiple roots
-            for(unsigned mi=1; mi<m; ++mi)
-            {
-                result[k] = result[k-1];
-                k += 1;
-            }
-        }
-        else
-        {
-            double e1 = std::abs(evaluate(coeffs, simples1[i])),
-                   e2 = std::abs(evaluate(coeffs, simples2[i]));
-
-            if (e1 < e2) result[k] = simples1[i];
-            else result[k] = simples2[i];
-            k += 1;
-        }
+        // duplicate multiple roots
+        for(unsigned mi=0; mi<mult[i]; ++mi) result[k++] = z;
     }
+    timings.select = lap(t0);
+
+    // Horner passes: 2 per root for multiplicities, 1 for f(z) and f'(z) of
+    // unrefined roots, and 1 for refined roots; refinement counts its own
+    SIMPOLY_STATS(s, s->evaluations += 4 * m; s->timings = timings);
 
     return result;
 }
 
 
-CArry yan_and_chieng_2006(const DArry &coeffs, const double tol)
+CArry yan_and_chieng_2006(const DArry &coeffs, PhaseTimings &timings,
+        const double tol, const RootMethod method, const unsigned nthreads)
 {
     CHECK_COEFS(coeffs, 1e-12);
 
-    // use exact solution for low-degree polynomials
-    if (coeffs.size() < 4) return use_low_degree_formula(to_CArry(coeffs));
+    return yan_and_chieng_2006(to_CArry(coeffs), timings, tol, method, nthreads);
+}
 
-    CArry C = to_CArry(coeffs);
-    return yan_and_chieng_2006(C, tol);
+
+CArry yan_and_chieng_2006(const CArry &coeffs, const double tol,
+        const RootMethod method, const unsigned nthreads)
+{
+    PhaseTimings timings;
+    return yan_and_chieng_2006(coeffs, timings, tol, method, nthreads);
+}
+
+
+CArry yan_and_chieng_2006(const DArry &coeffs, const double tol,
+        const RootMethod method, const unsigned nthreads)
+{
+    PhaseTimings timings;
+    return yan_and_chieng_2006(to_CArry(coeffs), timings, tol, method, nthreads);
 }
 
 
 // explicit instantiation
-template double newton_raphson(const DArry &coeffs, const double guess, const double tol);
-template Cmplx newton_raphson(const CArry &coeffs, const Cmplx guess, const double tol);
+template double newton_raphson(const DArry &coeffs, const double guess,
+        const double tol, const Accuracy accuracy);
+template Cmplx newton_raphson(const CArry &coeffs, const Cmplx guess,
+        const double tol, const Accuracy accuracy);
 
 } // end of namespace basic
 } // end of namespace simpoly
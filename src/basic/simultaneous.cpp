@@ -0,0 +1,441 @@
+/**
+ * \file simultaneous.cpp
+ * \brief Simultaneous (Jacobi-style) Aberth iteration on split real/imag arrays,
+ *        and batched root finding built on it.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+
+# include <algorithm>
+# include <cmath>
+# include <cstring>
+# include <limits>
+
+# include "basic.h"
+# include "exceptions.h"
+# include "../parallel.h"
+
+
+namespace simpoly
+{
+namespace basic
+{
+
+namespace
+{
+
+// width of the pairwise reduction: independent accumulators, one per lane,
+// so the sum is vectorized without reassociating (i.e., without -ffast-math)
+const unsigned lanes = 4;
+
+# if defined(__GNUC__)
+
+// explicit SIMD through vector extensions of GCC and Clang; the loop with
+// per-lane arrays is not vectorized by GCC (-fopt-info-vec reports "couldn't
+// vectorize loop"), while this maps to SSE2/AVX divisions and multiply-adds
+typedef double vdouble __attribute__((vector_size(lanes * sizeof(double))));
+
+// accumulate sum_{j in [bg, ed)} 1 / (z - z_j) into (sr, si)
+inline void pairwise_sum(const double zr, const double zi,
+        const double *xr, const double *xi, const unsigned bg, const unsigned ed,
+        double &sr, double &si)
+{
+    vdouble ar = {0.0}, ai = {0.0}, x, y;
+
+    unsigned j = bg;
+    for(; j+lanes<=ed; j+=lanes)
+    {
+        std::memcpy(&x, xr+j, sizeof(x)); // unaligned loads
+        std::memcpy(&y, xi+j, sizeof(y));
+
+        const vdouble dr = zr - x, di = zi - y;
+        const vdouble inv = 1.0 / (dr * dr + di * di);
+        ar += dr * inv;
+        ai -= di * inv;
+    }
+
+    for(; j<ed; ++j)
+    {
+        const double dr = zr - xr[j], di = zi - xi[j];
+        const double inv = 1.0 / (dr * dr + di * di);
+        ar[0] += dr * inv;
+        ai[0] -= di * inv;
+    }
+
+    for(unsigned l=0; l<lanes; ++l) { sr += ar[l]; si += ai[l]; }
+}
+
+# else
+
+// accumulate sum_{j in [bg, ed)} 1 / (z - z_j) into (sr, si)
+inline void pairwise_sum(const double zr, const double zi,
+        const double *xr, const double *xi, const unsigned bg, const unsigned ed,
+        double &sr, double &si)
+{
+    double ar[lanes] = {0.0}, ai[lanes] = {0.0};
+
+    unsigned j = bg;
+    for(; j+lanes<=ed; j+=lanes)
+        for(unsigned l=0; l<lanes; ++l)
+        {
+            const double dr = zr - xr[j+l], di = zi - xi[j+l];
+            const double inv = 1.0 / (dr * dr + di * di);
+            ar[l] += dr * inv;
+            ai[l] -= di * inv;
+        }
+
+    for(; j<ed; ++j)
+    {
+        const double dr = zr - xr[j], di = zi - xi[j];
+        const double inv = 1.0 / (dr * dr + di * di);
+        ar[0] += dr * inv;
+        ai[0] -= di * inv;
+    }
+
+    for(unsigned l=0; l<lanes; ++l) { sr += ar[l]; si += ai[l]; }
+}
+
+# endif
+
+// evaluate p(z) and p'(z) together with Horner's scheme; with `reversed`, the
+// coefficients are taken in reverse order, i.e., the polynomial is z^n p(1/z)
+inline void horner2(const unsigned len, const double *cr, const double *ci,
+        const double zr, const double zi, const bool reversed,
+        double &pr, double &pi, double &dr, double &di)
+{
+    const unsigned last = reversed ? 0 : len - 1;
+    pr = cr[last]; pi = ci[last];
+    dr = 0.0; di = 0.0;
+
+    for(unsigned j=1; j<len; ++j)
+    {
+        const unsigned k = reversed ? j : len - 1 - j;
+
+        // d = d * z + p
+        double tr = dr * zr - di * zi + pr;
+        di = dr * zi + di * zr + pi;
+        dr = tr;
+
+        // p = p * z + c_k
+        tr = pr * zr - pi * zi + cr[k];
+        pi = pr * zi + pi * zr + ci[k];
+        pr = tr;
+    }
+}
+
+// |x + i y| without overflow or underflow in the squares
+inline double modulus(const double x, const double y)
+{
+    const double m = std::max(std::abs(x), std::abs(y));
+    if ((m == 0.0) || (! std::isfinite(m))) return m;
+
+    const double a = x / m, b = y / m;
+    return m * std::sqrt(a * a + b * b);
+}
+
+// (qr + i qi) = (ar + i ai) / (br + i bi); the divisor is scaled first so its
+// squared modulus stays in [1, 2]
+inline void divide(const double ar, const double ai, const double br, const double bi,
+        double &qr, double &qi)
+{
+    const double m = std::max(std::abs(br), std::abs(bi));
+    const double sr = br / m, si = bi / m, sn = m * (sr * sr + si * si);
+
+    qr = (ar * sr + ai * si) / sn;
+    qi = (ai * sr - ar * si) / sn;
+}
+
+// bound of rounding errors when evaluating with Horner's scheme at |z| = az
+inline double rounding_level(const unsigned len, const double *cr, const double *ci,
+        const double az, const bool reversed)
+{
+    double b = 0.0;
+    for(unsigned j=0; j<len; ++j)
+    {
+        const unsigned k = reversed ? j : len - 1 - j;
+        b = b * az + std::hypot(cr[k], ci[k]);
+    }
+
+    return 4.0 * len * std::numeric_limits<double>::epsilon() * b;
+}
+
+// outcomes of newton_ratio
+enum Ratio { ROUNDING_LEVEL, FOUND, STATIONARY };
+
+// the Newton correction (nr, ni) = p(z) / p'(z), unless p(z) is at the
+// rounding level of Horner's scheme, where z can not be improved any further
+// (Bini's stopping criterion), or p'(z) = 0. Outside the unit disk, p(z)
+// overflows at high degrees, so it goes through q(y) = y^n p(1/y) at
+// y = 1 / z, and p / p' = z q / (n q - y q').
+inline Ratio newton_ratio(const unsigned len, const double *cr, const double *ci,
+        const double zr, const double zi, double &nr, double &ni)
+{
+    const double az = modulus(zr, zi);
+    const bool reversed = (az > 1.0);
+
+    double yr = zr, yi = zi;
+    if (reversed) divide(1.0, 0.0, zr, zi, yr, yi);
+
+    double pr, pi, dr, di;
+    horner2(len, cr, ci, yr, yi, reversed, pr, pi, dr, di);
+
+    const double e = rounding_level(len, cr, ci, reversed ? 1.0 / az : az, reversed);
+    if (modulus(pr, pi) <= e) return ROUNDING_LEVEL;
+
+    if (reversed)
+    {
+        // d = n q - y q'
+        const double tr = (len - 1) * pr - (yr * dr - yi * di);
+        di = (len - 1) * pi - (yr * di + yi * dr);
+        dr = tr;
+    }
+
+    if ((dr == 0.0) && (di == 0.0)) return STATIONARY;
+
+    divide(pr, pi, dr, di, nr, ni);
+
+    if (reversed)
+    {
+        const double tr = nr * zr - ni * zi;
+        ni = nr * zi + ni * zr;
+        nr = tr;
+    }
+
+    return FOUND;
+}
+
+// Aberth sweeps on split arrays; returns the number of sweeps, or 0 if the
+// iteration does not converge within max_sweeps or some root fails. A root
+// fails when its correction is not finite; it then keeps its last iterate, and
+// its flag in work[2n, 3n) is set to -1.
+unsigned sweeps(const unsigned len,
+        const double *cr, const double *ci, double *zr, double *zi,
+        double *work, const double tol, const unsigned nthreads,
+        const unsigned max_sweeps)
+{
+    const unsigned n = len - 1; // number of roots
+
+    // work arrays: corrections (real & imag) and convergence flags (1: done,
+    // -1: failed)
+    double *delr = work, *deli = work + n, *done = work + 2 * n;
+    std::fill(done, done+n, 0.0);
+
+    // the same threads serve all sweeps
+    parallel::Team team(parallel::n_workers(n, nthreads));
+
+    for(unsigned iter=1; iter<=max_sweeps; ++iter)
+    {
+        // all corrections use roots of the previous sweep
+        team.for_range(n, [&](unsigned bg, unsigned ed)
+        {
+            for(unsigned i=bg; i<ed; ++i)
+            {
+                if (done[i] != 0.0) { delr[i] = deli[i] = 0.0; continue; }
+
+                double nr, ni, sr = 0.0, si = 0.0;
+                const Ratio r = newton_ratio(len, cr, ci, zr[i], zi[i], nr, ni);
+
+                if (r == ROUNDING_LEVEL)
+                {
+                    delr[i] = deli[i] = 0.0;
+                    continue;
+                }
+
+                if (r == STATIONARY) // perturb to escape a stationary point
+                {
+                    delr[i] = -1e-4 * (std::abs(zr[i]) + 1.0);
+                    deli[i] = -1e-4 * (std::abs(zi[i]) + 1.0);
+                    continue;
+                }
+
+                pairwise_sum(zr[i], zi[i], zr, zi, 0, i, sr, si);
+                pairwise_sum(zr[i], zi[i], zr, zi, i+1, n, sr, si);
+
+                // delta = ratio / (1 - ratio * S), without |p|^2 or |p'|^2,
+                // which overflow at high degrees
+                const double wr = 1.0 - (nr * sr - ni * si), wi = - (nr * si + ni * sr);
+
+                if ((wr == 0.0) && (wi == 0.0)) // perturb, as above
+                {
+                    delr[i] = -1e-4 * (std::abs(zr[i]) + 1.0);
+                    deli[i] = -1e-4 * (std::abs(zi[i]) + 1.0);
+                    continue;
+                }
+
+                divide(nr, ni, wr, wi, delr[i], deli[i]);
+            }
+        });
+
+        // update roots and convergence flags
+        bool all = true, failed = false;
+        for(unsigned i=0; i<n; ++i)
+        {
+            failed = failed || (done[i] < 0.0);
+            if (done[i] != 0.0) continue;
+
+            if (! (std::isfinite(delr[i]) && std::isfinite(deli[i])))
+            {
+                done[i] = -1.0;
+                failed = true;
+                continue;
+            }
+
+            const double dn = modulus(delr[i], deli[i]), zn = modulus(zr[i], zi[i]);
+
+            zr[i] -= delr[i];
+            zi[i] -= deli[i];
+
+            if (dn <= tol * zn) done[i] = 1.0;
+            else all = false;
+        }
+
+        if (all) return failed ? 0 : iter;
+    }
+
+    return 0;
+}
+
+} // end of anonymous namespace
+
+
+// simultaneous Aberth iteration on split arrays
+unsigned aberth_simultaneous(const unsigned len,
+        const double *cr, const double *ci, double *zr, double *zi,
+        double *work, const double tol, const unsigned nthreads)
+{
+    const unsigned iter = sweeps(len, cr, ci, zr, zi, work, tol, nthreads, 10000);
+
+    if (iter == 0)
+    {
+        const double *done = work + 2 * (len - 1);
+        if (std::find(done, done+len-1, -1.0) != done+len-1)
+            throw exceptions::PolynomialErrorGeneral(
+                    __FL__, "A correction of Aberth's method is not finite.");
+
+        throw exceptions::InfLoop(__FILE__, __LINE__);
+    }
+
+    return iter;
+}
+
+
+CArry aberth_simultaneous(const CArry &coeffs, const CArry &guess,
+        const double tol, const unsigned nthreads)
+{
+    CHECK_COEFS(coeffs, 1e-12);
+
+    if (guess.size() != coeffs.size() - 1)
+        throw exceptions::UnmatchedLength(__FL__, guess.size(), coeffs.size()-1);
+
+    // use exact solution for low-degree polynomials
+    if (coeffs.size() < 6) return aberth(coeffs, guess, tol);
+
+    const unsigned len = coeffs.size(), n = len - 1;
+
+    // one block: coefficients, roots, and work space, all split real/imag
+    DArry buf(2 * len + 2 * n + 3 * n);
+    double *cr = buf.data(), *ci = cr + len,
+           *zr = ci + len, *zi = zr + n, *work = zi + n;
+
+    for(unsigned k=0; k<len; ++k) { cr[k] = coeffs[k].real(); ci[k] = coeffs[k].imag(); }
+    for(unsigned i=0; i<n; ++i) { zr[i] = guess[i].real(); zi[i] = guess[i].imag(); }
+
+    aberth_simultaneous(len, cr, ci, zr, zi, work, tol, nthreads);
+
+    CArry rts(n);
+    for(unsigned i=0; i<n; ++i) rts[i] = Cmplx(zr[i], zi[i]);
+
+    return rts;
+}
+
+
+CArry aberth_simultaneous(const DArry &coeffs, const CArry &guess,
+        const double tol, const unsigned nthreads)
+{
+    CHECK_COEFS(coeffs, 1e-12);
+
+    return aberth_simultaneous(to_CArry(coeffs), guess, tol, nthreads);
+}
+
+
+CArry aberth_simultaneous(const CArry &coeffs,
+        const double tol, const unsigned nthreads)
+{
+    CHECK_COEFS(coeffs, 1e-12);
+
+    return aberth_simultaneous(coeffs, initial_guess(coeffs), tol, nthreads);
+}
+
+
+CArry aberth_simultaneous(const DArry &coeffs,
+        const double tol, const unsigned nthreads)
+{
+    CHECK_COEFS(coeffs, 1e-12);
+
+    return aberth_simultaneous(to_CArry(coeffs), tol, nthreads);
+}
+
+
+// roots of many polynomials stored with a fixed stride
+void batch_roots(const unsigned N, const unsigned len, const double *coeffs,
+        const unsigned stride, double *re, double *im, int *status,
+        const double tol, const unsigned nthreads, const unsigned max_sweeps)
+{
+    const unsigned n = len - 1; // number of roots of each polynomial
+    const unsigned nt = parallel::n_workers(N, nthreads);
+
+    // per-thread scratch: cr, ci, mag (len each), lg (len), work (3n)
+    std::vector<DArry> arena(nt, DArry(4 * len + 3 * n));
+    std::vector<std::vector<unsigned>> iarena(nt, std::vector<unsigned>(2 * len));
+
+    parallel::for_dynamic(N, nthreads, 16, [&](unsigned tid, unsigned bg, unsigned ed)
+    {
+        double *cr = arena[tid].data(), *ci = cr + len, *mag = ci + len,
+               *lg = mag + len, *work = lg + len;
+        unsigned *iwork = iarena[tid].data();
+
+        for(unsigned p=bg; p<ed; ++p)
+        {
+            const double *c = coeffs + std::size_t(p) * stride;
+            double *zr = re + std::size_t(p) * n, *zi = im + std::size_t(p) * n;
+
+            bool valid = (c[n] != 0.0);
+            for(unsigned k=0; k<len; ++k) valid = valid && std::isfinite(c[k]);
+
+            if (! valid)
+            {
+                std::fill(zr, zr+n, std::nan(""));
+                std::fill(zi, zi+n, std::nan(""));
+                status[p] = RootStatus::BAD_COEFFS;
+                continue;
+            }
+
+            // closed forms for cubics and quartics
+            if ((n == 3) || (n == 4))
+            {
+                if (n == 3) cubic_roots(1, c, zr, zi);
+                else quartic_roots(1, c, zr, zi);
+                status[p] = RootStatus::CONVERGED;
+                continue;
+            }
+
+            for(unsigned k=0; k<len; ++k)
+            {
+                cr[k] = c[k];
+                ci[k] = 0.0;
+                mag[k] = std::abs(c[k]);
+            }
+
+            if (n > 0) initial_guess(len, mag, zr, zi, lg, iwork);
+
+            status[p] = (n == 0) ||
+                (sweeps(len, cr, ci, zr, zi, work, tol, 1, max_sweeps) != 0) ?
+                RootStatus::CONVERGED : RootStatus::NOT_CONVERGED;
+        }
+    });
+}
+
+} // end of namespace basic
+} // end of namespace simpoly
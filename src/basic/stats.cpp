@@ -0,0 +1,45 @@
+/**
+ * \file stats.cpp
+ * \brief Registration of root-finding statistics.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+
+# include "../stats.h"
+
+
+namespace simpoly
+{
+namespace basic
+{
+
+// the statistics registered on this thread
+RootStats *&current_stats()
+{
+    static thread_local RootStats *stats = nullptr;
+    return stats;
+}
+
+// register statistics
+RootStatsScope::RootStatsScope(RootStats &stats): _prev(current_stats())
+{
+    current_stats() = &stats;
+}
+
+// restore the previous scope
+RootStatsScope::~RootStatsScope() { current_stats() = _prev; }
+
+// whether instrumentation is compiled in
+bool root_stats_enabled()
+{
+# ifdef SIMPOLY_ROOT_STATS
+    return true;
+# else
+    return false;
+# endif
+}
+
+} // end of namespace basic
+} // end of namespace simpoly
@@ -0,0 +1,108 @@
+/**
+ * \file eft.h
+ * \brief Internal error-free transformations of floating-point sums and products.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# pragma once
+
+# include <cmath>
+
+
+namespace simpoly
+{
+namespace eft
+{
+
+/**
+ * \brief Knuth's TwoSum: a + b = s + e exactly, for any a and b.
+ *
+ * \param a [in] First term.
+ * \param b [in] Second term.
+ * \param s [out] The rounded sum fl(a + b).
+ * \param e [out] Its rounding error.
+ */
+inline void two_sum(const double a, const double b, double &s, double &e)
+{
+    s = a + b;
+    const double z = s - a;
+    e = (a - (s - z)) + (b - z);
+}
+
+/**
+ * \brief Dekker's FastTwoSum: a + b = s + e exactly, provided |a| >= |b|.
+ *
+ * \param a [in] Term of the larger magnitude.
+ * \param b [in] Term of the smaller magnitude.
+ * \param s [out] The rounded sum fl(a + b).
+ * \param e [out] Its rounding error.
+ */
+inline void fast_two_sum(const double a, const double b, double &s, double &e)
+{
+    s = a + b;
+    e = b - (s - a);
+}
+
+# ifdef FP_FAST_FMA
+
+/**
+ * \brief TwoProd: a * b = p + e exactly, barring underflow.
+ *
+ * With a hardware fma the product needs one instruction; otherwise Dekker's
+ * splitting gives the same result with plain multiplications.
+ *
+ * \param a [in] First factor.
+ * \param b [in] Second factor.
+ * \param p [out] The rounded product fl(a * b).
+ * \param e [out] Its rounding error.
+ */
+inline void two_prod(const double a, const double b, double &p, double &e)
+{
+    p = a * b;
+    e = std::fma(a, b, -p);
+}
+
+# else
+
+/**
+ * \brief Veltkamp's splitting of a into two halves of 26 bits each.
+ *
+ * \param a [in] The number to split.
+ * \param hi [out] The leading half.
+ * \param lo [out] The trailing half; a = hi + lo exactly.
+ */
+inline void split(const double a, double &hi, double &lo)
+{
+    const double c = 134217729.0 * a; // 2^27 + 1
+    hi = c - (c - a);
+    lo = a - hi;
+}
+
+/**
+ * \brief TwoProd: a * b = p + e exactly, barring underflow.
+ *
+ * With a hardware fma the product needs one instruction; otherwise Dekker's
+ * splitting gives the same result with plain multiplications.
+ *
+ * \param a [in] First factor.
+ * \param b [in] Second factor.
+ * \param p [out] The rounded product fl(a * b).
+ * \param e [out] Its rounding error.
+ */
+inline void two_prod(const double a, const double b, double &p, double &e)
+{
+    p = a * b;
+
+    double ah, al, bh, bl;
+    split(a, ah, al);
+    split(b, bh, bl);
+
+    e = al * bl - (((p - ah * bh) - al * bh) - ah * bl);
+}
+
+# endif
+
+} // end of namespace eft
+} // end of namespace simpoly
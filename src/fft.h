@@ -0,0 +1,71 @@
+/**
+ * \file fft.h
+ * \brief Internal, self-contained FFT and DCT-I of any length.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# pragma once
+
+# include "basic.h"
+
+
+namespace simpoly
+{
+namespace fft
+{
+
+/**
+ * \brief In-place discrete Fourier transform of any length.
+ *
+ * Forward: a_k <- sum_j a_j exp(-2 pi i jk / n). The inverse uses the
+ * opposite sign and divides by n. Powers of two use an iterative radix-2
+ * transform; other lengths use Bluestein's chirp-z algorithm on top of it,
+ * so every length costs O(n log n).
+ *
+ * \param a [in, out] Data.
+ * \param inverse [in] Whether to do the inverse transform (default: false).
+ */
+void fft(basic::CArry &a, const bool inverse=false);
+
+/**
+ * \brief In-place DCT-I, through an FFT of the even extension.
+ *
+ * With N = v.size() - 1:
+ *      v_k <- v_0 + (-1)^k v_N + 2 sum_{j=1}^{N-1} v_j cos(pi jk / N).
+ * Applying it twice multiplies by 2N.
+ *
+ * \param v [in, out] N + 1 values, N >= 1.
+ */
+void dct1(basic::DArry &v);
+
+/**
+ * \brief Linear convolution of two real sequences, i.e., the product of two
+ *        polynomials.
+ *
+ * Both sequences go through one complex FFT, packed as a + ib, and are
+ * split with the conjugate symmetry of real transforms.
+ *
+ * \param a [in] First sequence; not empty.
+ * \param b [in] Second sequence; not empty.
+ *
+ * \return a.size() + b.size() - 1 values.
+ */
+basic::DArry convolve(const basic::DArry &a, const basic::DArry &b);
+
+/**
+ * \brief Whether an FFT product beats the schoolbook one.
+ *
+ * Compares na nb multiply-adds against about 16 N log2(N) for two transforms
+ * of the padded length N.
+ *
+ * \param na [in] Length of the first factor.
+ * \param nb [in] Length of the second factor.
+ *
+ * \return True when convolve() is expected to be faster.
+ */
+bool use_fft(const unsigned na, const unsigned nb);
+
+} // end of namespace fft
+} // end of namespace simpoly
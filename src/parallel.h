@@ -0,0 +1,247 @@
+/**
+ * \file parallel.h
+ * \brief Internal helpers to split loops over std::thread.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# pragma once
+
+# include <algorithm>
+# include <atomic>
+# include <condition_variable>
+# include <functional>
+# include <mutex>
+# include <thread>
+# include <vector>
+
+
+namespace simpoly
+{
+namespace parallel
+{
+
+/**
+ * \brief Split [0, n) into contiguous chunks and run each chunk on a thread.
+ *
+ * The calling thread runs the first chunk itself. With nthreads <= 1, or when
+ * there are fewer items than threads, the whole range runs on the caller.
+ * Threads are created and joined on every call; iterative solvers running
+ * many short parallel loops should use a Team instead.
+ *
+ * \tparam F A callable with signature void(unsigned bg, unsigned ed).
+ * \param n [in] Number of items.
+ * \param nthreads [in] Number of threads to use.
+ * \param f [in] Function processing items in [bg, ed).
+ */
+template <typename F>
+void for_range(const unsigned n, const unsigned nthreads, const F &f)
+{
+    const unsigned nt = std::max(1u, std::min(nthreads, n));
+
+    if (nt == 1) { f(0u, n); return; }
+
+    const unsigned chunk = (n + nt - 1) / nt;
+    std::vector<std::thread> workers;
+
+    for(unsigned t=1; t<nt; ++t)
+    {
+        unsigned bg = std::min(n, t * chunk), ed = std::min(n, bg + chunk);
+        workers.push_back(std::thread(f, bg, ed));
+    }
+
+    f(0u, std::min(n, chunk));
+
+    for(auto &w: workers) w.join();
+}
+
+/**
+ * \brief Number of threads `for_range` and `for_dynamic` use for n items.
+ *
+ * \param n [in] Number of items.
+ * \param nthreads [in] Number of threads requested.
+ *
+ * \return The number of threads, including the calling one.
+ */
+inline unsigned n_workers(const unsigned n, const unsigned nthreads)
+{
+    return std::max(1u, std::min(nthreads, n));
+}
+
+/**
+ * \brief Run [0, n) in chunks that threads take from a shared counter.
+ *
+ * Unlike `for_range`, chunks are not assigned up front: a thread that finishes
+ * early simply takes the next chunk, so items of uneven cost stay balanced.
+ * Each call also receives the index of the thread (0 for the caller), which
+ * callers use to pick per-thread scratch space.
+ *
+ * \tparam F A callable with signature void(unsigned tid, unsigned bg, unsigned ed).
+ * \param n [in] Number of items.
+ * \param nthreads [in] Number of threads to use.
+ * \param grain [in] Number of items per chunk.
+ * \param f [in] Function processing items in [bg, ed) on thread tid.
+ */
+template <typename F>
+void for_dynamic(const unsigned n, const unsigned nthreads,
+        const unsigned grain, const F &f)
+{
+    const unsigned nt = n_workers(n, nthreads), g = std::max(1u, grain);
+
+    std::atomic<unsigned> next(0);
+
+    auto worker = [&](unsigned tid)
+    {
+        for(unsigned bg=next.fetch_add(g); bg<n; bg=next.fetch_add(g))
+            f(tid, bg, std::min(n, bg + g));
+    };
+
+    std::vector<std::thread> workers;
+    for(unsigned t=1; t<nt; ++t) workers.push_back(std::thread(worker, t));
+
+    worker(0u);
+
+    for(auto &w: workers) w.join();
+}
+
+/**
+ * \brief A fixed team of threads running many short parallel loops.
+ *
+ * The workers are created once and wait between loops, spinning briefly and
+ * then blocking, so a solver runs every sweep of its iteration on the same
+ * threads instead of paying thread creation per sweep. The calling thread is
+ * member 0 of the team and takes part in every loop.
+ */
+class Team
+{
+public:
+
+    /**
+     * \brief Constructor.
+     *
+     * \param nthreads [in] Number of threads, including the calling one.
+     */
+    explicit Team(const unsigned nthreads):
+        _nt(std::max(1u, nthreads)), _n(0), _gen(0), _pending(0), _stop(false)
+    {
+        for(unsigned t=1; t<_nt; ++t) _workers.push_back(std::thread(&Team::_work, this, t));
+    }
+
+    /** \brief Destructor; stops and joins the workers. */
+    ~Team()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+            ++_gen;
+        }
+        _start.notify_all();
+
+        for(auto &w: _workers) w.join();
+    }
+
+    Team(const Team &) = delete;
+    Team &operator=(const Team &) = delete;
+
+    /** \brief Number of threads, including the calling one. */
+    unsigned size() const { return _nt; }
+
+    /**
+     * \brief Split [0, n) into contiguous chunks, one per member, and return
+     *        when all chunks are done.
+     *
+     * \tparam F A callable with signature void(unsigned bg, unsigned ed).
+     * \param n [in] Number of items.
+     * \param f [in] Function processing items in [bg, ed).
+     */
+    template <typename F>
+    void for_range(const unsigned n, const F &f)
+    {
+        if ((_nt == 1) || (n < 2)) { f(0u, n); return; }
+
+        _n = n;
+        _job = [&f](unsigned bg, unsigned ed) { f(bg, ed); };
+        _pending.store(_nt - 1);
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            ++_gen;
+        }
+        _start.notify_all();
+
+        _chunk(0);
+
+        for(unsigned k=0; (k<spins) && (_pending.load() != 0); ++k)
+            std::this_thread::yield();
+
+        if (_pending.load() != 0)
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _done.wait(lock, [this] { return _pending.load() == 0; });
+        }
+    }
+
+private:
+
+    static const unsigned spins = 256; ///< yields before blocking
+
+    unsigned _nt; ///< number of threads, including the caller
+    std::vector<std::thread> _workers; ///< members 1 to _nt-1
+
+    unsigned _n; ///< number of items of the current loop
+    std::function<void(unsigned, unsigned)> _job; ///< body of the current loop
+
+    std::atomic<unsigned> _gen; ///< number of loops started
+    std::atomic<unsigned> _pending; ///< workers still running the current loop
+    std::atomic<bool> _stop; ///< whether workers should exit
+
+    std::mutex _mutex; ///< guards sleeping on the condition variables
+    std::condition_variable _start; ///< a loop started, or the team stops
+    std::condition_variable _done; ///< the last worker finished a loop
+
+    /** \brief Run the chunk of member t. */
+    void _chunk(const unsigned t)
+    {
+        const unsigned chunk = (_n + _nt - 1) / _nt,
+                       bg = std::min(_n, t * chunk), ed = std::min(_n, bg + chunk);
+        if (bg < ed) _job(bg, ed);
+    }
+
+    /** \brief Loop of member t: wait for a loop, run its chunk, report. */
+    void _work(const unsigned t)
+    {
+        unsigned seen = 0;
+
+        for(;;)
+        {
+            unsigned g = _gen.load();
+            for(unsigned k=0; (k<spins) && (g == seen); ++k)
+            {
+                std::this_thread::yield();
+                g = _gen.load();
+            }
+
+            if (g == seen)
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _start.wait(lock, [&] { return _gen.load() != seen; });
+                g = _gen.load();
+            }
+
+            seen = g;
+            if (_stop.load()) return;
+
+            _chunk(t);
+
+            if (_pending.fetch_sub(1) == 1)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _done.notify_one();
+            }
+        }
+    }
+};
+
+} // end of namespace parallel
+} // end of namespace simpoly
@@ -0,0 +1,201 @@
+/**
+ * \file basic_polynomial.cpp
+ * \brief Implementation and explicit instantiations of BasicPolynomial.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# include <algorithm>
+# include <limits>
+
+# include "basic_polynomial.h"
+# include "exceptions.h"
+
+
+using namespace simpoly::basic;
+
+
+namespace simpoly
+{
+namespace poly
+{
+
+namespace
+{
+
+// at most this many Aberth sweeps in T after the double engine
+const unsigned polish_sweeps = 8;
+
+// Aberth sweeps in the precision of T, in place; converged roots are frozen
+template <typename T>
+void polish_roots(const Arry<T> &c, Arry<std::complex<T>> &z)
+{
+    typedef std::complex<T> C;
+
+    const T eps = std::numeric_limits<T>::epsilon();
+    std::vector<bool> done(z.size(), false);
+
+    for(unsigned s=0; s<polish_sweeps; ++s)
+    {
+        bool all = true;
+
+        for(unsigned i=0; i<z.size(); ++i)
+        {
+            if (done[i]) continue;
+
+            // p(z) and p'(z) by Horner's scheme
+            C f = c.back(), df = T(0);
+            for(unsigned k=c.size()-1; k-->0; )
+            {
+                df = df * z[i] + f;
+                f = f * z[i] + c[k];
+            }
+
+            if ((f == T(0)) || (df == T(0))) { done[i] = true; continue; }
+
+            C S = T(0);
+            for(unsigned j=0; j<z.size(); ++j)
+                if ((j != i) && (z[i] != z[j])) S += T(1) / (z[i] - z[j]);
+
+            const C N = f / df, w = N / (T(1) - N * S);
+            z[i] -= w;
+
+            done[i] = (std::abs(w) <= 4 * eps * std::abs(z[i]));
+            all = all && done[i];
+        }
+
+        if (all) break;
+    }
+}
+
+} // end of anonymous namespace
+
+// constructors
+template <typename T>
+BasicPolynomial<T>::BasicPolynomial(): _coef(1, T(0)) {}
+
+template <typename T>
+BasicPolynomial<T>::BasicPolynomial(const Arry<T> &coef): _coef(coef)
+{
+    CHECK_COEFS(_coef, 1e-12);
+}
+
+template <typename T>
+BasicPolynomial<T>::BasicPolynomial(const Polynomial &p)
+{
+    const DArry c = p.coef();
+    _coef.assign(c.begin(), c.end());
+}
+
+// getters
+template <typename T>
+unsigned BasicPolynomial<T>::degree() const { return _coef.size() - 1; }
+
+template <typename T>
+const Arry<T> &BasicPolynomial<T>::coef() const { return _coef; }
+
+// conversion to double
+template <typename T>
+Polynomial BasicPolynomial<T>::to_polynomial() const
+{
+    return Polynomial(DArry(_coef.begin(), _coef.end()));
+}
+
+// roots from the double engine, refined in T when T is wider
+template <typename T>
+Arry<std::complex<T>> BasicPolynomial<T>::roots() const
+{
+    const CArry rd = to_polynomial().roots();
+    Arry<std::complex<T>> z(rd.begin(), rd.end());
+
+    if (std::numeric_limits<T>::epsilon() < std::numeric_limits<double>::epsilon())
+        polish_roots(_coef, z);
+
+    return z;
+}
+
+// evaluation
+template <typename T>
+T BasicPolynomial<T>::operator()(const T x) const { return basic::evaluate(_coef, x); }
+
+template <typename T>
+Arry<T> BasicPolynomial<T>::operator()(const Arry<T> &x) const
+{
+    Arry<T> y(x.size());
+    evaluate(x.size(), x.data(), y.data());
+    return y;
+}
+
+template <typename T>
+void BasicPolynomial<T>::evaluate(const unsigned n, const T *x, T *y) const
+{
+    std::fill(y, y+n, _coef.back());
+
+    for(unsigned k=_coef.size()-1; k-->0; )
+    {
+        const T c = _coef[k];
+        for(unsigned i=0; i<n; ++i) y[i] = y[i] * x[i] + c;
+    }
+}
+
+// calculus
+template <typename T>
+BasicPolynomial<T> BasicPolynomial<T>::deriv() const
+{ return BasicPolynomial(derivative(_coef)); }
+
+template <typename T>
+BasicPolynomial<T> BasicPolynomial<T>::integ() const
+{ return BasicPolynomial(integral(_coef)); }
+
+// division
+template <typename T>
+BasicPolynomial<T> BasicPolynomial<T>::divide(
+        const BasicPolynomial &divisor, BasicPolynomial &R) const
+{
+    Arry<T> r;
+    BasicPolynomial Q(basic::divide(_coef, divisor._coef, r));
+
+    if (r.empty()) r.assign(1, T(0));
+    R = BasicPolynomial(r);
+
+    return Q;
+}
+
+// compound assignments
+template <typename T>
+BasicPolynomial<T> &BasicPolynomial<T>::operator+=(const BasicPolynomial &rhs)
+{ _coef = add(_coef, rhs._coef); return *this; }
+
+template <typename T>
+BasicPolynomial<T> &BasicPolynomial<T>::operator+=(const T &rhs)
+{ _coef[0] += rhs; return *this; }
+
+template <typename T>
+BasicPolynomial<T> &BasicPolynomial<T>::operator-=(const BasicPolynomial &rhs)
+{ _coef = substract(_coef, rhs._coef); return *this; }
+
+template <typename T>
+BasicPolynomial<T> &BasicPolynomial<T>::operator-=(const T &rhs)
+{ _coef[0] -= rhs; return *this; }
+
+template <typename T>
+BasicPolynomial<T> &BasicPolynomial<T>::operator*=(const BasicPolynomial &rhs)
+{ _coef = multiply(_coef, rhs._coef); return *this; }
+
+template <typename T>
+BasicPolynomial<T> &BasicPolynomial<T>::operator*=(const T &rhs)
+{ _coef = multiply(_coef, rhs); return *this; }
+
+template <typename T>
+BasicPolynomial<T> &BasicPolynomial<T>::operator/=(const T &rhs)
+{ _coef = basic::divide(_coef, rhs); return *this; }
+
+
+// explicit instantiation
+template class BasicPolynomial<float>;
+template class BasicPolynomial<double>;
+template class BasicPolynomial<long double>;
+
+} // end of namespace poly
+} // end of namespace simpoly
@@ -0,0 +1,277 @@
+/**
+ * \file chebyshev.cpp
+ * \brief Implementation of the class Chebyshev.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# include <algorithm>
+# include <cmath>
+
+# include "chebyshev.h"
+# include "exceptions.h"
+# include "../fft.h"
+
+
+using namespace simpoly::basic;
+using namespace simpoly::exceptions;
+
+
+namespace simpoly
+{
+namespace poly
+{
+
+// constructor
+Chebyshev::Chebyshev(const DArry &coef): _coef(coef)
+{
+    if (_coef.empty()) throw ZeroCoeffsLength(__FL__);
+}
+
+// constructor: Horner's scheme in the Chebyshev basis
+Chebyshev::Chebyshev(const Polynomial &p)
+{
+    const DArry a = p.coef();
+    _coef.assign(1, a.back());
+
+    for(unsigned k=a.size()-1; k-->0; )
+    {
+        // x T_0 = T_1 and x T_j = (T_{j+1} + T_{j-1}) / 2
+        DArry r(_coef.size()+1, 0.0);
+        r[1] = _coef[0];
+        for(unsigned j=1; j<_coef.size(); ++j)
+        {
+            r[j+1] += 0.5 * _coef[j];
+            r[j-1] += 0.5 * _coef[j];
+        }
+        r[0] += a[k];
+
+        _coef.swap(r);
+    }
+}
+
+// Chebyshev points of the second kind
+DArry Chebyshev::points(const unsigned n)
+{
+    if (n == 0) return DArry(1, 0.0);
+
+    const double pi = std::acos(-1.0);
+
+    // cos(pi j / n) = sin(pi (n - 2j) / 2n), which is exactly symmetric
+    DArry x(n+1);
+    for(unsigned j=0; j<=n; ++j) x[j] = std::sin(pi * (int(n) - 2 * int(j)) / (2.0 * n));
+
+    return x;
+}
+
+// coefficients from values: c_k = (2/n) sum''_j v_j cos(pi jk / n)
+Chebyshev Chebyshev::interpolate(const DArry &values)
+{
+    if (values.empty()) throw ZeroCoeffsLength(__FL__);
+    if (values.size() == 1) return Chebyshev(values);
+
+    const unsigned n = values.size() - 1;
+
+    DArry c(values);
+    fft::dct1(c);
+
+    for(auto &it: c) it /= n;
+    c[0] /= 2.0;
+    c[n] /= 2.0;
+
+    return Chebyshev(c);
+}
+
+// values from coefficients, the inverse of interpolate
+DArry Chebyshev::values() const
+{
+    if (_coef.size() == 1) return _coef;
+
+    const unsigned n = degree();
+
+    DArry v(_coef);
+    v[0] *= 2.0;
+    v[n] *= 2.0;
+
+    fft::dct1(v);
+
+    for(auto &it: v) it /= 2.0;
+    return v;
+}
+
+// getters
+unsigned Chebyshev::degree() const { return _coef.size() - 1; }
+const DArry &Chebyshev::coef() const { return _coef; }
+
+// monomial coefficients, accumulating T_{k+1} = 2x T_k - T_{k-1} and T_1 = x
+Polynomial Chebyshev::to_polynomial() const
+{
+    const unsigned n = degree();
+
+    DArry p(n+1, 0.0), Tm1, T(1, 1.0);
+    p[0] = _coef[0];
+
+    for(unsigned k=1; k<=n; ++k)
+    {
+        DArry Tp1(k+1, 0.0);
+        for(unsigned i=0; i<T.size(); ++i) Tp1[i+1] = ((k == 1) ? 1.0 : 2.0) * T[i];
+        for(unsigned i=0; i<Tm1.size(); ++i) Tp1[i] -= Tm1[i];
+
+        for(unsigned i=0; i<=k; ++i) p[i] += _coef[k] * Tp1[i];
+
+        Tm1.swap(T);
+        T.swap(Tp1);
+    }
+
+    return Polynomial(p);
+}
+
+// Clenshaw's algorithm
+double Chebyshev::operator()(const double x) const
+{
+    double b1 = 0.0, b2 = 0.0;
+
+    for(unsigned k=_coef.size()-1; k>0; --k)
+    {
+        const double t = _coef[k] + 2.0 * x * b1 - b2;
+        b2 = b1;
+        b1 = t;
+    }
+
+    return _coef[0] + x * b1 - b2;
+}
+
+// evaluation
+DArry Chebyshev::operator()(const DArry &x) const
+{
+    DArry y(x.size());
+    evaluate(x.size(), x.data(), y.data());
+    return y;
+}
+
+// Clenshaw's algorithm across points
+void Chebyshev::evaluate(const unsigned n, const double *x, double *y) const
+{
+    DArry b2(n, 0.0);
+    std::fill(y, y+n, 0.0);
+
+    for(unsigned k=_coef.size()-1; k>0; --k)
+    {
+        const double c = _coef[k];
+
+        for(unsigned i=0; i<n; ++i)
+        {
+            const double t = c + 2.0 * x[i] * y[i] - b2[i];
+            b2[i] = y[i];
+            y[i] = t;
+        }
+    }
+
+    for(unsigned i=0; i<n; ++i) y[i] = _coef[0] + x[i] * y[i] - b2[i];
+}
+
+// derivative: d_{k-1} = d_{k+1} + 2k c_k, with d_0 halved
+Chebyshev Chebyshev::deriv() const
+{
+    const unsigned n = degree();
+    if (n == 0) return Chebyshev(DArry(1, 0.0));
+
+    DArry d(n+2, 0.0); // two extra zeros for d_{k+1}
+
+    for(unsigned k=n; k>0; --k) d[k-1] = d[k+1] + 2.0 * k * _coef[k];
+
+    d.resize(n);
+    d[0] /= 2.0;
+
+    return Chebyshev(d);
+}
+
+// integral: C_k = (c_{k-1} - c_{k+1}) / (2k), with c_0 doubled
+Chebyshev Chebyshev::integ() const
+{
+    const unsigned n = degree();
+
+    DArry C(n+2, 0.0);
+
+    for(unsigned k=1; k<=n+1; ++k)
+    {
+        const double prev = (k == 1) ? 2.0 * _coef[0] : _coef[k-1],
+                     next = (k + 1 <= n) ? _coef[k+1] : 0.0;
+        C[k] = (prev - next) / (2.0 * k);
+    }
+
+    // T_k(-1) = (-1)^k
+    for(unsigned k=1; k<=n+1; ++k) C[0] -= (k % 2 == 0) ? C[k] : -C[k];
+
+    return Chebyshev(C);
+}
+
+// +=
+Chebyshev &Chebyshev::operator+=(const Chebyshev &rhs)
+{
+    if (_coef.size() < rhs._coef.size()) _coef.resize(rhs._coef.size(), 0.0);
+    for(unsigned k=0; k<rhs._coef.size(); ++k) _coef[k] += rhs._coef[k];
+    return *this;
+}
+
+// -=
+Chebyshev &Chebyshev::operator-=(const Chebyshev &rhs)
+{
+    if (_coef.size() < rhs._coef.size()) _coef.resize(rhs._coef.size(), 0.0);
+    for(unsigned k=0; k<rhs._coef.size(); ++k) _coef[k] -= rhs._coef[k];
+    return *this;
+}
+
+// *=
+Chebyshev &Chebyshev::operator*=(const Chebyshev &rhs)
+{
+    const DArry &a = _coef, &b = rhs._coef;
+    DArry r(a.size() + b.size() - 1, 0.0);
+
+    for(unsigned i=0; i<a.size(); ++i)
+        for(unsigned j=0; j<b.size(); ++j)
+        {
+            const double h = 0.5 * a[i] * b[j];
+            r[i+j] += h;
+            r[(i > j) ? (i-j) : (j-i)] += h;
+        }
+
+    _coef.swap(r);
+    return *this;
+}
+
+// *=
+Chebyshev &Chebyshev::operator*=(const double &rhs)
+{
+    for(auto &it: _coef) it *= rhs;
+    return *this;
+}
+
+// /=
+Chebyshev &Chebyshev::operator/=(const double &rhs)
+{
+    if (rhs == 0.0) throw DivideByZero(__FL__);
+
+    for(auto &it: _coef) it /= rhs;
+    return *this;
+}
+
+
+// +
+Chebyshev operator+(Chebyshev lhs, const Chebyshev &rhs) { lhs += rhs; return lhs; }
+
+// -
+Chebyshev operator-(Chebyshev lhs, const Chebyshev &rhs) { lhs -= rhs; return lhs; }
+
+// *
+Chebyshev operator*(Chebyshev lhs, const Chebyshev &rhs) { lhs *= rhs; return lhs; }
+
+// *
+Chebyshev operator*(Chebyshev lhs, const double &rhs) { lhs *= rhs; return lhs; }
+
+// *
+Chebyshev operator*(const double &lhs, Chebyshev rhs) { rhs *= lhs; return rhs; }
+
+} // end of namespace poly
+} // end of namespace simpoly
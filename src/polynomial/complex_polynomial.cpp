@@ -0,0 +1,354 @@
+/**
+ * \file complex_polynomial.cpp
+ * \brief Implementation of the class ComplexPolynomial.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# include <algorithm>
+# include <cmath>
+
+# include "complex_polynomial.h"
+# include "exceptions.h"
+
+
+using namespace simpoly::basic;
+using namespace simpoly::exceptions;
+
+
+namespace simpoly
+{
+namespace poly
+{
+
+// constructors
+ComplexPolynomial::ComplexPolynomial() { set(CArry(1, 0.0)); }
+
+ComplexPolynomial::ComplexPolynomial(const CArry &coef) { set(coef); }
+
+ComplexPolynomial::ComplexPolynomial(const Cmplx &l, const CArry &roots) { set(l, roots); }
+
+ComplexPolynomial::ComplexPolynomial(const CArry &coef, const CArry &roots) { set(coef, roots); }
+
+ComplexPolynomial::ComplexPolynomial(const Polynomial &p) { set(to_CArry(p.coef())); }
+
+
+// re-set coefficients
+void ComplexPolynomial::set(const CArry &coef)
+{
+    CHECK_COEFS(coef, 1e-12);
+
+    _coef = coef;
+    _drop_roots();
+}
+
+// re-set roots
+void ComplexPolynomial::set(const Cmplx &l, const CArry &roots)
+{
+    _roots = roots;
+    _coef = to_coefficients(l, _roots);
+    _use_roots = true;
+    _have_roots = true;
+}
+
+// re-set both roots and coefficients
+void ComplexPolynomial::set(const CArry &coef, const CArry &roots)
+{
+    CHECK_COEFS(coef, 1e-12);
+
+    _coef = coef;
+    _roots = roots;
+    _use_roots = false;
+    _have_roots = true;
+
+# ifndef NDEBUG
+    if (_coef.size() != _roots.size() + 1)
+        throw UnmatchedLength(__FL__, _coef.size() - 1, _roots.size());
+
+    for(const auto &it: _roots)
+    {
+        Cmplx value = basic::evaluate(_coef, it);
+        if (std::abs(value) > 1e-12) throw ExpectingZero(__FL__, std::abs(value));
+    }
+# endif
+}
+
+// re-set only one coefficient
+void ComplexPolynomial::set(const int d, const Cmplx &value)
+{
+    _coef[d] = value;
+    _drop_roots();
+}
+
+// re-set root-finding engine
+void ComplexPolynomial::set(const RootMethod &method)
+{
+    _method = method;
+
+    // roots given by users are exact; others will be re-calculated
+    if (! _use_roots) _have_roots = false;
+}
+
+// re-set accuracy mode
+void ComplexPolynomial::set(const Accuracy &accuracy)
+{
+    _accuracy = accuracy;
+
+    // roots given by users are exact; others will be re-calculated
+    if (! _use_roots) _have_roots = false;
+}
+
+// getters
+unsigned ComplexPolynomial::degree() const { return _coef.size() - 1; }
+const CArry &ComplexPolynomial::coef() const { return _coef; }
+RootMethod ComplexPolynomial::root_method() const { return _method; }
+Accuracy ComplexPolynomial::accuracy() const { return _accuracy; }
+const RootStats &ComplexPolynomial::root_stats() const
+{
+    static const RootStats zeros;
+    return _stats ? *_stats : zeros;
+}
+bool ComplexPolynomial::use_roots() const { return _use_roots; }
+
+// get all roots
+const CArry &ComplexPolynomial::roots() const
+{
+    if (! _have_roots) _get_roots();
+    return _roots;
+}
+
+// derivative
+ComplexPolynomial ComplexPolynomial::deriv() const
+{ return ComplexPolynomial(derivative(_coef)); }
+
+// integral
+ComplexPolynomial ComplexPolynomial::integ() const
+{ return ComplexPolynomial(integral(_coef)); }
+
+// remove known roots and keep cached roots consistent
+void ComplexPolynomial::deflate(const CArry &roots)
+{
+    basic::deflate(_coef, roots);
+
+    if (! _have_roots) return;
+
+    for(const auto &z: roots)
+    {
+        // the cached root nearest to z
+        auto nearest = std::min_element(_roots.begin(), _roots.end(),
+            [&z](const Cmplx &a, const Cmplx &b) { return std::abs(z-a) < std::abs(z-b); });
+
+        if ((nearest == _roots.end()) ||
+                (std::abs(z - *nearest) > 1e-6 * std::max(1.0, std::abs(z))))
+        {
+            // the cache does not match the given roots
+            _drop_roots();
+            return;
+        }
+
+        _roots.erase(nearest);
+    }
+}
+
+// division
+ComplexPolynomial ComplexPolynomial::divide(
+        const ComplexPolynomial &divisor, ComplexPolynomial &R) const
+{
+    CArry r;
+    ComplexPolynomial Q(basic::divide(_coef, divisor._coef, r));
+
+    if (r.empty()) r.assign(1, 0.0);
+    R.set(r);
+
+    return Q;
+}
+
+// quotient
+ComplexPolynomial ComplexPolynomial::quotient(const ComplexPolynomial &divisor) const
+{
+    ComplexPolynomial R;
+    return divide(divisor, R);
+}
+
+// remainder
+ComplexPolynomial ComplexPolynomial::remainder(const ComplexPolynomial &divisor) const
+{
+    ComplexPolynomial R;
+    divide(divisor, R);
+    return R;
+}
+
+// evaluation
+Cmplx ComplexPolynomial::operator()(const Cmplx &x) const
+{
+    if (_use_roots) return evaluate_from_root(_coef.back(), _roots, x);
+    return basic::evaluate(_coef, x, _accuracy);
+}
+
+// evaluation
+CArry ComplexPolynomial::operator()(const CArry &x) const
+{
+    CArry y(x.size());
+    evaluate(x.size(), x.data(), y.data());
+    return y;
+}
+
+// evaluation into a raw buffer
+void ComplexPolynomial::evaluate(const unsigned n, const Cmplx *x, Cmplx *y) const
+{
+    if (_use_roots || (_accuracy == Accuracy::COMPENSATED))
+    {
+        for(unsigned i=0; i<n; ++i) y[i] = operator()(x[i]);
+        return;
+    }
+
+    std::fill(y, y+n, _coef.back());
+
+    for(unsigned k=_coef.size()-1; k-->0; )
+    {
+        const Cmplx c = _coef[k];
+        for(unsigned i=0; i<n; ++i) y[i] = y[i] * x[i] + c;
+    }
+}
+
+// +=
+ComplexPolynomial &ComplexPolynomial::operator+=(const ComplexPolynomial &rhs)
+{ set(add(_coef, rhs._coef)); return *this; }
+
+// +=
+ComplexPolynomial &ComplexPolynomial::operator+=(const Cmplx &rhs)
+{ set(add(_coef, rhs)); return *this; }
+
+// -=
+ComplexPolynomial &ComplexPolynomial::operator-=(const ComplexPolynomial &rhs)
+{ set(substract(_coef, rhs._coef)); return *this; }
+
+// -=
+ComplexPolynomial &ComplexPolynomial::operator-=(const Cmplx &rhs)
+{ set(substract(_coef, rhs)); return *this; }
+
+// *=
+ComplexPolynomial &ComplexPolynomial::operator*=(const ComplexPolynomial &rhs)
+{
+    _coef = multiply(_coef, rhs._coef);
+
+    if (_have_roots && rhs._have_roots) // multiplication doesn't change roots
+    {
+        _roots.insert(_roots.end(), rhs._roots.begin(), rhs._roots.end());
+        _use_roots = _use_roots && rhs._use_roots;
+    }
+    else
+        _drop_roots();
+
+    return *this;
+}
+
+// *=
+ComplexPolynomial &ComplexPolynomial::operator*=(const Cmplx &rhs)
+{ _coef = multiply(_coef, rhs); return *this; }
+
+// /=
+ComplexPolynomial &ComplexPolynomial::operator/=(const Cmplx &rhs)
+{ _coef = basic::divide(_coef, rhs); return *this; }
+
+// ==
+bool ComplexPolynomial::operator==(const ComplexPolynomial &rhs) const
+{
+    if (_coef.size() != rhs._coef.size()) return false;
+
+    for(unsigned i=0; i<_coef.size(); ++i)
+        if (std::abs(_coef[i]-rhs._coef[i]) > 1e-12 * std::abs(_coef[i]))
+            return false;
+
+    return true;
+}
+
+// !=
+bool ComplexPolynomial::operator!=(const ComplexPolynomial &rhs) const
+{ return ! (this->operator==(rhs)); }
+
+// private function to get roots
+void ComplexPolynomial::_get_roots() const
+{
+    ComplexPolynomial *self = const_cast<ComplexPolynomial*>(this);
+
+    // statistics of this call only; a fresh object, since copies share it
+    self->_stats.reset();
+    if (root_stats_enabled()) self->_stats = std::make_shared<RootStats>();
+
+    if (_stats)
+    {
+        RootStatsScope scope(*self->_stats);
+        self->_roots = yan_and_chieng_2006(_coef, 1e-10, _method);
+    }
+    else
+        self->_roots = yan_and_chieng_2006(_coef, 1e-10, _method);
+
+    if (_accuracy == Accuracy::COMPENSATED) polish(_coef, self->_roots);
+
+    self->_have_roots = true;
+}
+
+// discard cached roots
+void ComplexPolynomial::_drop_roots()
+{
+    _roots.clear();
+    _use_roots = false;
+    _have_roots = false;
+}
+
+
+// +
+ComplexPolynomial operator+(ComplexPolynomial lhs, const ComplexPolynomial &rhs)
+{ lhs += rhs; return lhs; }
+
+// +
+ComplexPolynomial operator+(ComplexPolynomial lhs, const Cmplx &rhs)
+{ lhs += rhs; return lhs; }
+
+// +
+ComplexPolynomial operator+(const Cmplx &lhs, ComplexPolynomial rhs)
+{ rhs += lhs; return rhs; }
+
+// -
+ComplexPolynomial operator-(ComplexPolynomial lhs, const ComplexPolynomial &rhs)
+{ lhs -= rhs; return lhs; }
+
+// -
+ComplexPolynomial operator-(ComplexPolynomial lhs, const Cmplx &rhs)
+{ lhs -= rhs; return lhs; }
+
+// -
+ComplexPolynomial operator-(const Cmplx &lhs, const ComplexPolynomial &rhs)
+{ return ComplexPolynomial(substract(lhs, rhs.coef())); }
+
+// *
+ComplexPolynomial operator*(ComplexPolynomial lhs, const ComplexPolynomial &rhs)
+{ lhs *= rhs; return lhs; }
+
+// *
+ComplexPolynomial operator*(ComplexPolynomial lhs, const Cmplx &rhs)
+{ lhs *= rhs; return lhs; }
+
+// *
+ComplexPolynomial operator*(const Cmplx &lhs, ComplexPolynomial rhs)
+{ rhs *= lhs; return rhs; }
+
+// /
+ComplexPolynomial operator/(ComplexPolynomial lhs, const Cmplx &rhs)
+{ lhs /= rhs; return lhs; }
+
+// %
+ComplexPolynomial operator%(const ComplexPolynomial &lhs, const ComplexPolynomial &rhs)
+{ return lhs.remainder(rhs); }
+
+// <<
+std::ostream &operator<<(std::ostream &os, const ComplexPolynomial &rhs)
+{
+    basic::operator<<(os, rhs.coef());
+    return os;
+}
+
+} // end of namespace poly
+} // end of namespace simpoly
@@ -0,0 +1,170 @@
+/**
+ * \file lagrange.cpp
+ * \brief Implementation of the class Lagrange.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# include <algorithm>
+# include <cmath>
+
+# include "exceptions.h"
+# include "lagrange.h"
+# include "../barycentric.h"
+
+
+using namespace simpoly::basic;
+using namespace simpoly::exceptions;
+
+
+namespace simpoly
+{
+namespace poly
+{
+
+// constructor
+Lagrange::Lagrange(const DArry &nodes)
+{
+    _scale = barycentric::capacity_scale(nodes);
+
+    _nodes.reserve(nodes.size());
+    _weights.reserve(nodes.size());
+    for(const auto &x: nodes) add_node(x);
+}
+
+// add a node
+void Lagrange::add_node(const double x)
+{
+    barycentric::add_node(_nodes, _weights, _scale, x);
+}
+
+// number of nodes
+unsigned Lagrange::size() const { return _nodes.size(); }
+
+// nodes
+const DArry &Lagrange::nodes() const { return _nodes; }
+
+// weights
+const DArry &Lagrange::weights() const { return _weights; }
+
+// find the node coinciding with x
+int Lagrange::_find_node(const double x) const
+{
+    for(unsigned j=0; j<_nodes.size(); ++j) if (_nodes[j] == x) return j;
+    return -1;
+}
+
+// evaluate one basis polynomial
+double Lagrange::operator()(const unsigned j, const double x) const
+{
+# ifndef NDEBUG
+    if (j >= _nodes.size()) throw UnmatchedLength(__FL__, j, _nodes.size());
+# endif
+
+    const int k = _find_node(x);
+    if (k >= 0) return (unsigned(k) == j) ? 1.0 : 0.0;
+
+    double sum = 0.0;
+    for(unsigned i=0; i<_nodes.size(); ++i) sum += _weights[i] / (x - _nodes[i]);
+
+    return (_weights[j] / (x - _nodes[j])) / sum;
+}
+
+// evaluate all basis polynomials
+DArry Lagrange::operator()(const double x) const
+{
+    DArry result(_nodes.size());
+    evaluate(DArry(1, x), result.data());
+    return result;
+}
+
+// batch evaluation
+void Lagrange::evaluate(const DArry &x, double *out) const
+{
+    const unsigned n = _nodes.size();
+    const double *xn = _nodes.data(), *w = _weights.data();
+
+    for(unsigned k=0; k<x.size(); ++k)
+    {
+        double *row = out + std::size_t(k) * n;
+        const double &xk = x[k];
+
+        const int j = _find_node(xk);
+        if (j >= 0)
+        {
+            std::fill(row, row+n, 0.0);
+            row[j] = 1.0;
+            continue;
+        }
+
+        // no branches in the two loops below, so compilers can vectorize them
+        double sum = 0.0;
+        for(unsigned i=0; i<n; ++i)
+        {
+            row[i] = w[i] / (xk - xn[i]);
+            sum += row[i];
+        }
+
+        const double inv = 1.0 / sum;
+        for(unsigned i=0; i<n; ++i) row[i] *= inv;
+    }
+}
+
+// batch evaluation
+DArry Lagrange::evaluate(const DArry &x) const
+{
+    DArry result(x.size() * _nodes.size());
+    evaluate(x, result.data());
+    return result;
+}
+
+// evaluate interpolant
+double Lagrange::interpolate(const DArry &values, const double x) const
+{
+# ifndef NDEBUG
+    if (values.size() != _nodes.size())
+        throw UnmatchedLength(__FL__, values.size(), _nodes.size());
+# endif
+
+    const int k = _find_node(x);
+    if (k >= 0) return values[k];
+
+    double num = 0.0, den = 0.0;
+    for(unsigned i=0; i<_nodes.size(); ++i)
+    {
+        double t = _weights[i] / (x - _nodes[i]);
+        num += t * values[i];
+        den += t;
+    }
+
+    return num / den;
+}
+
+// convert to Polynomial
+Polynomial Lagrange::to_polynomial(const unsigned j) const
+{
+# ifndef NDEBUG
+    if (j >= _nodes.size()) throw UnmatchedLength(__FL__, j, _nodes.size());
+# endif
+
+    DArry roots;
+    roots.reserve(_nodes.size());
+
+    // leading coefficient: 1 / prod_{k!=j} (x_j - x_k)
+    double l = 1.0;
+    for(unsigned k=0; k<_nodes.size(); ++k)
+    {
+        if (k == j) continue;
+        roots.push_back(_nodes[k]);
+        l /= (_nodes[j] - _nodes[k]);
+    }
+
+    Polynomial p(l, roots);
+    p.set(PolyType::LAGRANGE);
+
+    return p;
+}
+
+} // end of namespace poly
+} // end of namespace simpoly
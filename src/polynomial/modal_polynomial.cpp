@@ -0,0 +1,331 @@
+/**
+ * \file modal_polynomial.cpp
+ * \brief Implementation of the class ModalPolynomial.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# include <algorithm>
+
+# include "exceptions.h"
+# include "modal_polynomial.h"
+
+
+using namespace simpoly::basic;
+using namespace simpoly::exceptions;
+
+
+namespace simpoly
+{
+namespace poly
+{
+
+namespace
+{
+
+// P_{k+1} = (A_k x + B_k) P_k - C_k P_{k-1} for k < n; the same recurrence
+// as the factory Jacobi()
+void recurrence(const double alpha, const double beta, const unsigned n,
+        DArry &A, DArry &B, DArry &C)
+{
+    const double c1 = alpha + beta;
+
+    A.resize(n);
+    B.resize(n);
+    C.resize(n);
+
+    for(unsigned k=0; k<n; ++k)
+    {
+        if (k == 0)
+        {
+            A[0] = c1 / 2. + 1.;
+            B[0] = (alpha - beta) / 2.;
+            C[0] = 0.0;
+            continue;
+        }
+
+        const double a1 = 2.0 * (k + 1) * (k + 1 + c1) * (2 * k + c1);
+        A[k] = (2 * k + c1) * (2 * k + 1 + c1) * (2 * k + 2 + c1) / a1;
+        B[k] = (2 * k + 1 + c1) * c1 * (alpha - beta) / a1;
+        C[k] = 2.0 * (alpha + k) * (beta + k) * (2 * k + 2 + c1) / a1;
+    }
+}
+
+// modal coefficients of x * v, using x P_j = (P_{j+1} - B_j P_j + C_j P_{j-1}) / A_j
+DArry times_x(const DArry &v, const DArry &A, const DArry &B, const DArry &C)
+{
+    DArry out(v.size()+1, 0.0);
+
+    for(unsigned j=0; j<v.size(); ++j)
+    {
+        const double w = v[j] / A[j];
+        out[j+1] += w;
+        out[j] -= B[j] * w;
+        if (j > 0) out[j-1] += C[j] * w;
+    }
+
+    return out;
+}
+
+// y += a * x over the first x.size() entries
+inline void axpy(const double a, const DArry &x, DArry &y)
+{
+    for(unsigned i=0; i<x.size(); ++i) y[i] += a * x[i];
+}
+
+} // end of anonymous namespace
+
+
+// constructor
+ModalPolynomial::ModalPolynomial(const DArry &coef, const double alpha,
+        const double beta): _alpha(alpha), _beta(beta), _coef(coef) { _setup(); }
+
+// constructor: Horner's scheme in the modal basis
+ModalPolynomial::ModalPolynomial(const Polynomial &p, const double alpha,
+        const double beta): _alpha(alpha), _beta(beta), _coef(p.coef())
+{
+    _setup();
+
+    const DArry a = p.coef();
+    DArry r(1, a.back());
+
+    for(unsigned k=a.size()-1; k-->0; )
+    {
+        r = times_x(r, _A, _B, _C);
+        r[0] += a[k];
+    }
+
+    _coef = r;
+}
+
+// getters
+unsigned ModalPolynomial::degree() const { return _coef.size() - 1; }
+const DArry &ModalPolynomial::coef() const { return _coef; }
+double ModalPolynomial::alpha() const { return _alpha; }
+double ModalPolynomial::beta() const { return _beta; }
+
+// Clenshaw's algorithm on monomial coefficients
+Polynomial ModalPolynomial::to_polynomial() const
+{
+    const unsigned N = degree();
+    DArry b1(1, _coef[N]), b2;
+
+    for(unsigned k=N; k-->0; )
+    {
+        // t = c_k + (A_k x + B_k) b1 - C_{k+1} b2
+        DArry t(b1.size()+1, 0.0);
+        for(unsigned i=0; i<b1.size(); ++i)
+        {
+            t[i+1] += _A[k] * b1[i];
+            t[i] += _B[k] * b1[i];
+        }
+        axpy(-_C[k+1], b2, t);
+        t[0] += _coef[k];
+
+        b2.swap(b1);
+        b1.swap(t);
+    }
+
+    return Polynomial(b1);
+}
+
+// Clenshaw's algorithm
+double ModalPolynomial::operator()(const double x) const
+{
+    double b1 = _coef.back(), b2 = 0.0;
+
+    for(unsigned k=_coef.size()-1; k-->0; )
+    {
+        const double t = _coef[k] + (_A[k] * x + _B[k]) * b1 - _C[k+1] * b2;
+        b2 = b1;
+        b1 = t;
+    }
+
+    return b1;
+}
+
+// evaluation
+DArry ModalPolynomial::operator()(const DArry &x) const
+{
+    DArry y(x.size());
+    evaluate(x.size(), x.data(), y.data());
+    return y;
+}
+
+// Clenshaw's algorithm across points
+void ModalPolynomial::evaluate(const unsigned n, const double *x, double *y) const
+{
+    DArry b2(n, 0.0);
+    std::fill(y, y+n, _coef.back());
+
+    for(unsigned k=_coef.size()-1; k-->0; )
+    {
+        const double c = _coef[k], A = _A[k], B = _B[k], C = _C[k+1];
+
+        for(unsigned i=0; i<n; ++i)
+        {
+            const double t = c + (A * x[i] + B) * y[i] - C * b2[i];
+            b2[i] = y[i];
+            y[i] = t;
+        }
+    }
+}
+
+// derivative
+ModalPolynomial ModalPolynomial::deriv() const
+{
+    const unsigned N = degree();
+    if (N == 0) return ModalPolynomial(DArry(1, 0.0), _alpha, _beta);
+
+    DArry d(N, 0.0);
+
+    if ((_alpha == 0.0) && (_beta == 0.0))
+    {
+        // Legendre: d_k = (2k+1) (c_{k+1} + d_{k+2} / (2k+5))
+        for(unsigned k=N; k-->0; )
+            d[k] = (2 * k + 1) * (_coef[k+1] + ((k + 2 < N) ? d[k+2] / (2 * k + 5) : 0.0));
+
+        return ModalPolynomial(d, _alpha, _beta);
+    }
+
+    // P'_{k+1} = A_k P_k + (A_k x + B_k) P'_k - C_k P'_{k-1}
+    DArry Dm1, D(1, _A[0]); // P'_0 and P'_1
+
+    for(unsigned k=1; k<=N; ++k)
+    {
+        axpy(_coef[k], D, d);
+
+        if (k == N) break;
+
+        DArry Dp1 = times_x(D, _A, _B, _C);
+        for(auto &it: Dp1) it *= _A[k];
+        axpy(_B[k], D, Dp1);
+        axpy(-_C[k], Dm1, Dp1);
+        Dp1[k] += _A[k];
+
+        Dm1.swap(D);
+        D.swap(Dp1);
+    }
+
+    return ModalPolynomial(d, _alpha, _beta);
+}
+
+// +=
+ModalPolynomial &ModalPolynomial::operator+=(const ModalPolynomial &rhs)
+{
+    _check_basis(rhs);
+
+    if (_coef.size() < rhs._coef.size()) _coef.resize(rhs._coef.size(), 0.0);
+    axpy(1.0, rhs._coef, _coef);
+
+    _setup();
+    return *this;
+}
+
+// -=
+ModalPolynomial &ModalPolynomial::operator-=(const ModalPolynomial &rhs)
+{
+    _check_basis(rhs);
+
+    if (_coef.size() < rhs._coef.size()) _coef.resize(rhs._coef.size(), 0.0);
+    axpy(-1.0, rhs._coef, _coef);
+
+    _setup();
+    return *this;
+}
+
+// *=: f * g = sum_j g_j (f P_j), with f P_j from the recurrence
+ModalPolynomial &ModalPolynomial::operator*=(const ModalPolynomial &rhs)
+{
+    _check_basis(rhs);
+
+    // the recurrence runs over the factor of lower degree
+    const DArry &f = (_coef.size() >= rhs._coef.size()) ? _coef : rhs._coef,
+                &g = (_coef.size() >= rhs._coef.size()) ? rhs._coef : _coef;
+
+    DArry A, B, C;
+    recurrence(_alpha, _beta, f.size() + g.size(), A, B, C);
+
+    DArry result(f.size() + g.size() - 1, 0.0), Fm1, F(f);
+    axpy(g[0], F, result);
+
+    for(unsigned j=0; j+1<g.size(); ++j)
+    {
+        DArry Fp1 = times_x(F, A, B, C);
+        for(auto &it: Fp1) it *= A[j];
+        axpy(B[j], F, Fp1);
+        axpy(-C[j], Fm1, Fp1);
+
+        axpy(g[j+1], Fp1, result);
+
+        Fm1.swap(F);
+        F.swap(Fp1);
+    }
+
+    _coef.swap(result);
+
+    _setup();
+    return *this;
+}
+
+// *=
+ModalPolynomial &ModalPolynomial::operator*=(const double &rhs)
+{
+    for(auto &it: _coef) it *= rhs;
+    return *this;
+}
+
+// /=
+ModalPolynomial &ModalPolynomial::operator/=(const double &rhs)
+{
+    if (rhs == 0.0) throw DivideByZero(__FL__);
+
+    for(auto &it: _coef) it /= rhs;
+    return *this;
+}
+
+// check parameters and tabulate the recurrence up to the degree
+void ModalPolynomial::_setup()
+{
+# ifndef NDEBUG
+    if (_alpha <= -1.0) throw JacobiParameters(__FL__, _alpha, _beta);
+    if (_beta <= -1.0) throw JacobiParameters(__FL__, _alpha, _beta);
+# endif
+
+    if (_coef.empty()) throw ZeroCoeffsLength(__FL__);
+
+    recurrence(_alpha, _beta, _coef.size(), _A, _B, _C);
+}
+
+// basis check
+void ModalPolynomial::_check_basis(const ModalPolynomial &rhs) const
+{
+    if ((_alpha != rhs._alpha) || (_beta != rhs._beta))
+        throw PolynomialErrorGeneral(__FL__,
+                "Operands are stored in different Jacobi bases.");
+}
+
+
+// +
+ModalPolynomial operator+(ModalPolynomial lhs, const ModalPolynomial &rhs)
+{ lhs += rhs; return lhs; }
+
+// -
+ModalPolynomial operator-(ModalPolynomial lhs, const ModalPolynomial &rhs)
+{ lhs -= rhs; return lhs; }
+
+// *
+ModalPolynomial operator*(ModalPolynomial lhs, const ModalPolynomial &rhs)
+{ lhs *= rhs; return lhs; }
+
+// *
+ModalPolynomial operator*(ModalPolynomial lhs, const double &rhs)
+{ lhs *= rhs; return lhs; }
+
+// *
+ModalPolynomial operator*(const double &lhs, ModalPolynomial rhs)
+{ rhs *= lhs; return rhs; }
+
+} // end of namespace poly
+} // end of namespace simpoly
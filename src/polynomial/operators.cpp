@@ -41,7 +41,7 @@ Polynomial Polynomial::remainder(const Polynomial &divisor)
 double Polynomial::operator()(const double x) const
 {
     if (_use_roots) return evaluate_from_root(_coef.back(), _rroots, x);
-    return evaluate(_coef, x);
+    return evaluate(_coef, x, _accuracy);
 }
 
 // evaluation
@@ -53,7 +53,7 @@ DArry Polynomial::operator()(const DArry &x) const
             result[i] = evaluate_from_root(_coef.back(), _rroots, x[i]);
 
     for(unsigned i=0; i<x.size(); ++i)
-        result[i] = evaluate(_coef, x[i]);
+        result[i] = evaluate(_coef, x[i], _accuracy);
 
     return result;
 }
@@ -204,6 +204,12 @@ std::ostream & operator<<(std::ostream &os, const Polynomial &rhs)
     return os;
 }
 
+// poly::compose
+Polynomial compose(const Polynomial &p, const Polynomial &q)
+{
+    return Polynomial(basic::compose(p.coef(), q.coef()));
+}
+
 // poly::divide
 Polynomial divide(const Polynomial &p1, const Polynomial &p2, Polynomial &R)
 {
@@ -6,6 +6,7 @@
  * \date 2018-01-28
  */
 
+# include <algorithm>
 # include <cmath>
 
 # include "exceptions.h"
@@ -54,6 +55,24 @@ Polynomial::Polynomial(const DArry &coef, const DArry &rroots,
 // re-set type
 void Polynomial::set(const PolyType &type) { _type = type; }
 
+// re-set root-finding engine
+void Polynomial::set(const RootMethod &method)
+{
+    _method = method;
+
+    // roots given by users are exact; others will be re-calculated
+    if (! _use_roots) _have_roots = false;
+}
+
+// re-set accuracy mode
+void Polynomial::set(const Accuracy &accuracy)
+{
+    _accuracy = accuracy;
+
+    // roots given by users are exact; others will be re-calculated
+    if (! _use_roots) _have_roots = false;
+}
+
 // re-set coefficient
 void Polynomial::set(const DArry &coef)
 {
@@ -226,7 +245,21 @@ void Polynomial::_get_roots(const double tol) const
     const_cast<Polynomial*>(this)->_rroots.clear(); // assured it's empty
     const_cast<Polynomial*>(this)->_croots.clear(); // assured it's empty
 
-    CArry tmp = yan_and_chieng_2006(_coef);
+    // statistics of this call only; a fresh object, since copies share it
+    std::shared_ptr<RootStats> stats;
+    if (root_stats_enabled()) stats = std::make_shared<RootStats>();
+    const_cast<Polynomial*>(this)->_stats = stats;
+
+    CArry tmp;
+    if (stats)
+    {
+        RootStatsScope scope(*stats);
+        tmp = yan_and_chieng_2006(_coef, 1e-10, _method);
+    }
+    else
+        tmp = yan_and_chieng_2006(_coef, 1e-10, _method);
+
+    if (_accuracy == Accuracy::COMPENSATED) polish(_coef, tmp);
 
     for(const auto &it: tmp)
     {
@@ -244,6 +277,19 @@ void Polynomial::_get_roots(const double tol) const
 // get a string of type
 PolyType Polynomial::type() const { return _type; }
 
+// get root-finding engine
+RootMethod Polynomial::root_method() const { return _method; }
+
+// get accuracy mode
+Accuracy Polynomial::accuracy() const { return _accuracy; }
+
+// get statistics of the latest root finding
+const RootStats &Polynomial::root_stats() const
+{
+    static const RootStats zeros;
+    return _stats ? *_stats : zeros;
+}
+
 // get a bool indicating whether to use roots or coefficients for evaluation
 bool Polynomial::use_roots() const { return _use_roots; }
 
@@ -274,6 +320,23 @@ DArry Polynomial::real_roots(const double tol) const
     return _rroots;
 }
 
+// get real roots in [a, b]
+DArry Polynomial::real_roots_in(const double a, const double b,
+        const double tol) const
+{
+    if (! _use_roots) return basic::real_roots_in(_coef, a, b, tol);
+
+    if (! (a < b)) throw PolynomialErrorGeneral(
+            __FL__, "The interval [a, b] requires a < b.");
+
+    DArry result;
+    for(const auto &it: _rroots) if ((it >= a) && (it <= b)) result.push_back(it);
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+
+    return result;
+}
+
 // get complex roots
 CArry Polynomial::cmplx_roots(const double tol) const
 {
@@ -297,5 +360,86 @@ Polynomial Polynomial::deriv() const { return Polynomial(derivative(_coef)); }
 // integral
 Polynomial Polynomial::integ() const { return Polynomial(integral(_coef)); }
 
+// Taylor shift
+Polynomial Polynomial::shift(const double c) const
+{
+    if (_d < 128) return Polynomial(taylor_shift(_coef, c));
+    return Polynomial(taylor_shift_fast(_coef, c));
+}
+
+// composition with an affine map
+Polynomial Polynomial::compose_affine(const double s, const double t) const
+{
+    if ((_d < 128) || (s == 0.0)) return Polynomial(basic::compose_affine(_coef, s, t));
+
+    DArry c = taylor_shift_fast(_coef, t);
+
+    double sk = 1.0;
+    for(auto &it: c) { it *= sk; sk *= s; }
+
+    return Polynomial(c);
+}
+
+// remove known real roots
+void Polynomial::deflate(const DArry &roots) { _deflate(roots, CArry()); }
+
+// remove known roots
+void Polynomial::deflate(const CArry &roots)
+{
+    DArry rr;
+    CArry cr;
+    for(const auto &it: roots)
+        if (it.imag() == 0.0) rr.push_back(it.real()); else cr.push_back(it);
+
+    _deflate(rr, cr);
+}
+
+// remove known roots and keep cached roots consistent
+void Polynomial::_deflate(const DArry &rroots, const CArry &croots)
+{
+    basic::deflate(_coef, rroots, croots);
+
+    _d = _coef.size() - 1;
+    _type = PolyType::GENERAL;
+
+    if (! _have_roots) return;
+
+    // drop the cached root nearest to z; real roots may be cached as complex
+    // numbers and vice versa
+    auto drop = [this](const Cmplx &z)->bool {
+        int ir = -1, ic = -1;
+        double best = 1e-6 * std::max(1.0, std::abs(z));
+
+        for(unsigned i=0; i<_rroots.size(); ++i)
+            if (std::abs(z - _rroots[i]) <= best) { best = std::abs(z - _rroots[i]); ir = i; }
+        for(unsigned i=0; i<_croots.size(); ++i)
+            if (std::abs(z - _croots[i]) <= best) { best = std::abs(z - _croots[i]); ic = i; ir = -1; }
+
+        if (ic >= 0) _croots.erase(_croots.begin()+ic);
+        else if (ir >= 0) _rroots.erase(_rroots.begin()+ir);
+        else return false;
+
+        return true;
+    };
+
+    bool found = true;
+    for(const auto &it: rroots) found = found && drop(it);
+    for(const auto &it: croots) found = found && drop(it);
+
+    if (found)
+    {
+        _nrr = _rroots.size();
+        _ncr = _croots.size();
+        return;
+    }
+
+    // the cache does not match the given roots
+    _nrr = _ncr = 0;
+    _rroots.clear();
+    _croots.clear();
+    _use_roots = false;
+    _have_roots = false;
+}
+
 } // end of namespace poly
 } // end of namespace simpoly
@@ -0,0 +1,205 @@
+/**
+ * \file ppoly.cpp
+ * \brief Implementation of the class PPoly.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# include <algorithm>
+# include <cmath>
+
+# include "exceptions.h"
+# include "ppoly.h"
+
+
+using namespace simpoly::basic;
+using namespace simpoly::exceptions;
+
+
+namespace simpoly
+{
+namespace poly
+{
+
+// constructor
+PPoly::PPoly(const DArry &breaks, const std::vector<Polynomial> &pieces):
+    _breaks(breaks), _k(0)
+{
+    if (_breaks.size() != pieces.size() + 1)
+        throw UnmatchedLength(__FL__, _breaks.size(), pieces.size() + 1);
+
+    for(const auto &it: pieces) _k = std::max(_k, it.degree());
+
+    _coef.assign(pieces.size() * (_k + 1), 0.0);
+
+    for(unsigned i=0; i<pieces.size(); ++i)
+    {
+        const DArry c = pieces[i].coef();
+        std::copy(c.begin(), c.end(), _coef.begin() + i * (_k + 1));
+        taylor_shift(&_coef[i * (_k + 1)], _k + 1, _breaks[i]);
+    }
+
+    _setup();
+}
+
+// constructor
+PPoly::PPoly(const DArry &breaks, const unsigned degree, const DArry &coef):
+    _breaks(breaks), _k(degree), _coef(coef)
+{
+    if (_coef.size() != (_breaks.size() - 1) * (_k + 1))
+        throw UnmatchedLength(__FL__, _coef.size(), (_breaks.size() - 1) * (_k + 1));
+
+    _setup();
+}
+
+// getters
+unsigned PPoly::size() const { return _breaks.size() - 1; }
+unsigned PPoly::degree() const { return _k; }
+const DArry &PPoly::breaks() const { return _breaks; }
+const DArry &PPoly::coef() const { return _coef; }
+bool PPoly::uniform() const { return _uniform; }
+
+// one piece in x
+Polynomial PPoly::piece(const unsigned i) const
+{
+    if (i >= size()) throw UnmatchedLength(__FL__, i, size());
+
+    DArry c(_coef.begin() + i * (_k + 1), _coef.begin() + (i + 1) * (_k + 1));
+    taylor_shift(c.data(), _k + 1, -_breaks[i]);
+
+    // pieces of lower degree are padded with zeros
+    while ((c.size() > 1) && (c.back() == 0.0)) c.pop_back();
+
+    return Polynomial(c);
+}
+
+// locate the interval
+unsigned PPoly::find(const double x) const
+{
+    const unsigned m = size();
+
+    if (_uniform)
+    {
+        // the bucket, then at most one step to fix rounding near breakpoints
+        const double t = (x - _breaks[0]) * _inv_h;
+        unsigned i = (t <= 0.0) ? 0 : ((t >= m) ? (m - 1) : unsigned(t));
+
+        if ((i > 0) && (x < _breaks[i])) --i;
+        else if ((i + 1 < m) && (x >= _breaks[i+1])) ++i;
+
+        return i;
+    }
+
+    // branchless binary search for the last b_i <= x among b_0..b_{m-1}
+    const double *base = _breaks.data();
+    unsigned len = m;
+
+    while (len > 1)
+    {
+        const unsigned half = len / 2;
+        base = (base[half] <= x) ? base + half : base;
+        len -= half;
+    }
+
+    return base - _breaks.data();
+}
+
+// evaluation
+double PPoly::operator()(const double x) const
+{
+    const unsigned i = find(x);
+    return basic::evaluate(&_coef[i * (_k + 1)], _k + 1, x - _breaks[i]);
+}
+
+// evaluation
+DArry PPoly::operator()(const DArry &x) const
+{
+    DArry y(x.size());
+    evaluate(x.size(), x.data(), y.data());
+    return y;
+}
+
+// binned evaluation
+void PPoly::evaluate(const unsigned n, const double *x, double *y) const
+{
+    const unsigned m = size(), w = _k + 1;
+
+    // too few points to share coefficient blocks
+    if (8 * n < m)
+    {
+        for(unsigned p=0; p<n; ++p) y[p] = operator()(x[p]);
+        return;
+    }
+
+    // counting sort of points by interval
+    std::vector<unsigned> cell(n), start(m+1, 0);
+    for(unsigned p=0; p<n; ++p) { cell[p] = find(x[p]); ++start[cell[p]+1]; }
+    for(unsigned i=0; i<m; ++i) start[i+1] += start[i];
+
+    std::vector<unsigned> next(start.begin(), start.end()-1), order(n);
+    DArry t(n), v(n);
+
+    for(unsigned p=0; p<n; ++p)
+    {
+        const unsigned q = next[cell[p]]++;
+        order[q] = p;
+        t[q] = x[p] - _breaks[cell[p]];
+    }
+
+    // Horner's scheme across the points of each bin
+    for(unsigned i=0; i<m; ++i)
+    {
+        const unsigned bg = start[i], ed = start[i+1];
+        if (bg == ed) continue;
+
+        const double *c = &_coef[i * w];
+
+        std::fill(v.begin() + bg, v.begin() + ed, c[_k]);
+        for(unsigned j=_k; j-->0; )
+            for(unsigned q=bg; q<ed; ++q) v[q] = v[q] * t[q] + c[j];
+    }
+
+    for(unsigned q=0; q<n; ++q) y[order[q]] = v[q];
+}
+
+// derivative
+PPoly PPoly::deriv() const
+{
+    const unsigned m = size();
+    if (_k == 0) return PPoly(_breaks, 0, DArry(m, 0.0));
+
+    DArry d(m * _k);
+    for(unsigned i=0; i<m; ++i)
+        for(unsigned j=1; j<=_k; ++j)
+            d[i * _k + j - 1] = j * _coef[i * (_k + 1) + j];
+
+    return PPoly(_breaks, _k - 1, d);
+}
+
+// check breakpoints and build the index
+void PPoly::_setup()
+{
+    if (_breaks.size() < 2) throw UnmatchedLength(__FL__, _breaks.size(), 2);
+
+    const unsigned m = _breaks.size() - 1;
+
+    for(unsigned i=0; i<m; ++i)
+        if (! (_breaks[i] < _breaks[i+1]))
+            throw PolynomialErrorGeneral(__FL__, "Breakpoints must be increasing.");
+
+    // uniform if every breakpoint is where the bucket formula puts it
+    const double h = (_breaks[m] - _breaks[0]) / m;
+    _inv_h = 1.0 / h;
+    _uniform = true;
+
+    for(unsigned i=1; i<m; ++i)
+        if (std::abs(_breaks[i] - (_breaks[0] + i * h)) > 1e-10 * h)
+        {
+            _uniform = false;
+            break;
+        }
+}
+
+} // end of namespace poly
+} // end of namespace simpoly
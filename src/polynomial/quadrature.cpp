@@ -0,0 +1,481 @@
+/**
+ * \file quadrature.cpp
+ * \brief Implementation of quadrature rules and their registry.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# include <algorithm>
+# include <atomic>
+# include <cmath>
+# include <cstdint>
+# include <cstdio>
+# include <cstring>
+# include <fstream>
+# include <functional>
+# include <mutex>
+
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+
+# include "exceptions.h"
+# include "quadrature.h"
+
+
+using namespace simpoly::basic;
+using namespace simpoly::exceptions;
+
+
+namespace simpoly
+{
+namespace poly
+{
+
+// constructor
+QuadratureRule::QuadratureRule(const PolyType type, const unsigned n,
+        const double alpha, const double beta):
+    _type(type), _n(n), _alpha(0.0), _beta(0.0)
+{
+    if (n == 0) throw PolynomialErrorGeneral(
+            __FL__, "A quadrature rule needs at least one node.");
+
+    // the polynomial whose roots are the nodes
+    Polynomial p;
+    switch (type)
+    {
+        case PolyType::LEGENDRE:
+            p = Legendre(n);
+            break;
+        case PolyType::JACOBI:
+            p = Jacobi(alpha, beta, n);
+            _alpha = alpha;
+            _beta = beta;
+            break;
+        case PolyType::LEFTRADAU:
+        case PolyType::RIGHTRADAU:
+            p = Radau(n, type);
+            break;
+        default:
+            throw IllegalType(__FL__,
+                    "LEGENDRE, JACOBI, LEFTRADAU, and RIGHTRADAU");
+    }
+
+    const DArry c = p.coef();
+    const DArry d = derivative(c);
+
+    DArry x = p.real_roots();
+    if (x.size() != n) throw UnmatchedLength(__FL__, n, x.size());
+
+    // polish the nodes with the original polynomial and sort them
+    for(auto &it: x) it = newton_raphson(c, it);
+    std::sort(x.begin(), x.end());
+
+    DArry w(n);
+    switch (type)
+    {
+        case PolyType::LEGENDRE:
+        case PolyType::JACOBI:
+        {
+            // w_i = C / ((1 - x_i^2) * P_n'(x_i)^2)
+            const double C = std::exp(
+                    (_alpha + _beta + 1.0) * std::log(2.0) +
+                    std::lgamma(n + _alpha + 1.0) +
+                    std::lgamma(n + _beta + 1.0) -
+                    std::lgamma(n + _alpha + _beta + 1.0) -
+                    std::lgamma(n + 1.0));
+
+            for(unsigned i=0; i<n; ++i)
+            {
+                double dv = evaluate(d, x[i]);
+                w[i] = C / ((1.0 - x[i] * x[i]) * dv * dv);
+            }
+            break;
+        }
+        default: // LEFTRADAU & RIGHTRADAU
+        {
+            // fixed node gets 2/n^2; others get (1 -+ x_i) / (n P_{n-1}(x_i))^2
+            const DArry L = Legendre(n-1).coef();
+            const double s = (type == PolyType::LEFTRADAU) ? 1.0 : -1.0;
+            const unsigned fixed = (type == PolyType::LEFTRADAU) ? 0 : n - 1;
+
+            for(unsigned i=0; i<n; ++i)
+            {
+                double lv = n * evaluate(L, x[i]);
+                w[i] = (1.0 - s * x[i]) / (lv * lv);
+            }
+            w[fixed] = 2.0 / double(n * n);
+            break;
+        }
+    }
+
+    // one contiguous block: coefficients, nodes, weights
+    double *buf = new double[3*n+1];
+    std::copy(c.begin(), c.end(), buf);
+    std::copy(x.begin(), x.end(), buf+n+1);
+    std::copy(w.begin(), w.end(), buf+2*n+1);
+
+    _data.reset(buf, std::default_delete<double[]>());
+    _coef = buf;
+    _nodes = buf + n + 1;
+    _weights = buf + 2 * n + 1;
+}
+
+// constructor
+QuadratureRule::QuadratureRule(const PolyType type, const unsigned n,
+        const double alpha, const double beta,
+        const std::shared_ptr<const double> &data):
+    _type(type), _n(n), _alpha(alpha), _beta(beta), _data(data),
+    _coef(data.get()), _nodes(data.get()+n+1), _weights(data.get()+2*n+1) {}
+
+PolyType QuadratureRule::type() const { return _type; }
+
+unsigned QuadratureRule::size() const { return _n; }
+
+double QuadratureRule::alpha() const { return _alpha; }
+
+double QuadratureRule::beta() const { return _beta; }
+
+const double *QuadratureRule::nodes() const { return _nodes; }
+
+const double *QuadratureRule::weights() const { return _weights; }
+
+const double *QuadratureRule::coef() const { return _coef; }
+
+
+namespace
+{
+
+/** \brief Key identifying a rule in the registry. */
+struct RuleKey
+{
+    PolyType type;
+    unsigned n;
+    double alpha, beta;
+
+    bool operator==(const RuleKey &rhs) const
+    {
+        return (type == rhs.type) && (n == rhs.n) &&
+            (alpha == rhs.alpha) && (beta == rhs.beta);
+    }
+
+    std::size_t hash() const
+    {
+        std::size_t h = std::hash<int>()(int(type));
+        h = h * 31 + std::hash<unsigned>()(n);
+        h = h * 31 + std::hash<double>()(alpha);
+        h = h * 31 + std::hash<double>()(beta);
+        return h;
+    }
+};
+
+/** \brief A node in a bucket's singly linked list; never modified once published. */
+struct RuleEntry
+{
+    RuleKey key;
+    RulePtr rule;
+    const RuleEntry *next;
+};
+
+/**
+ * \brief Process-wide registry of quadrature rules.
+ *
+ * Each bucket is a singly linked list of immutable entries. Readers walk the
+ * lists without locking. Writers serialize on a mutex, build the rule, and
+ * publish it by a release store to the bucket head, so a reader either sees
+ * the complete entry or does not see it at all. Entries are never removed.
+ */
+class RuleRegistry
+{
+public:
+
+    static RuleRegistry &instance()
+    {
+        static RuleRegistry registry; // thread-safe initialization in C++11
+        return registry;
+    }
+
+    RulePtr get(const RuleKey &key)
+    {
+        std::atomic<const RuleEntry*> &head = _buckets[key.hash() % _nbkts];
+
+        // fast path: lock-free lookup
+        const RuleEntry *e = find(head.load(std::memory_order_acquire), key);
+        if (e != nullptr) return e->rule;
+
+        // slow path: another thread may have inserted it before we got the lock
+        std::lock_guard<std::mutex> lock(_mutex);
+        e = find(head.load(std::memory_order_relaxed), key);
+        if (e != nullptr) return e->rule;
+
+        RulePtr rule = std::make_shared<QuadratureRule>(
+                key.type, key.n, key.alpha, key.beta);
+
+        e = new RuleEntry{key, rule, head.load(std::memory_order_relaxed)};
+        head.store(e, std::memory_order_release);
+
+        return rule;
+    }
+
+    bool insert(const RuleKey &key, const RulePtr &rule)
+    {
+        std::atomic<const RuleEntry*> &head = _buckets[key.hash() % _nbkts];
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (find(head.load(std::memory_order_relaxed), key) != nullptr) return false;
+
+        const RuleEntry *e =
+            new RuleEntry{key, rule, head.load(std::memory_order_relaxed)};
+        head.store(e, std::memory_order_release);
+
+        return true;
+    }
+
+    std::vector<RulePtr> snapshot() const
+    {
+        std::vector<RulePtr> result;
+        for(const auto &head: _buckets)
+            for(auto e=head.load(std::memory_order_acquire); e!=nullptr; e=e->next)
+                result.push_back(e->rule);
+        return result;
+    }
+
+    ~RuleRegistry()
+    {
+        for(auto &head: _buckets)
+        {
+            const RuleEntry *e = head.load();
+            while (e != nullptr)
+            {
+                const RuleEntry *next = e->next;
+                delete e;
+                e = next;
+            }
+        }
+    }
+
+private:
+
+    static const unsigned _nbkts = 61;
+
+    std::atomic<const RuleEntry*> _buckets[_nbkts];
+    std::mutex _mutex;
+
+    RuleRegistry() { for(auto &head: _buckets) head.store(nullptr); }
+
+    static const RuleEntry *find(const RuleEntry *e, const RuleKey &key)
+    {
+        for(; e != nullptr; e = e->next) if (e->key == key) return e;
+        return nullptr;
+    }
+};
+
+} // end of anonymous namespace
+
+
+// get a rule from the registry
+RulePtr quadrature_rule(const PolyType type, const unsigned n,
+        const double alpha, const double beta)
+{
+    // alpha and beta only distinguish Jacobi rules
+    RuleKey key = (type == PolyType::JACOBI) ?
+        RuleKey{type, n, alpha, beta} : RuleKey{type, n, 0.0, 0.0};
+
+    return RuleRegistry::instance().get(key);
+}
+
+// build several rules ahead of time
+void prewarm_quadrature_rules(const PolyType type,
+        const std::vector<unsigned> &orders,
+        const double alpha, const double beta)
+{
+    for(const auto &n: orders) quadrature_rule(type, n, alpha, beta);
+}
+
+// get all registered rules
+std::vector<RulePtr> registered_quadrature_rules()
+{
+    return RuleRegistry::instance().snapshot();
+}
+
+
+namespace
+{
+
+const char cache_magic[8] = {'S', 'I', 'M', 'P', 'O', 'L', 'Y', 'Q'};
+const std::uint32_t cache_version = 1;
+const std::uint32_t cache_bom = 0x01020304;
+const std::uint64_t cache_align = 64;
+
+/** \brief Header of a cache file; exactly 64 bytes. */
+struct CacheHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t bom; // byte-order mark
+    std::uint64_t count; // number of rules
+    std::uint64_t bytes; // payload size (everything after the header)
+    std::uint64_t hash; // FNV-1a hash of the payload
+    char padding[24];
+};
+
+/** \brief Directory entry of a rule in a cache file. */
+struct CacheEntry
+{
+    std::int32_t type;
+    std::uint32_t n;
+    double alpha;
+    double beta;
+    std::uint64_t offset; // offset of the rule's arrays from the file start
+};
+
+static_assert(sizeof(CacheHeader) == 64, "CacheHeader should be 64 bytes.");
+static_assert(sizeof(CacheEntry) == 32, "CacheEntry should be 32 bytes.");
+
+std::uint64_t fnv1a(const char *bg, const std::uint64_t len)
+{
+    std::uint64_t h = 14695981039346656037ULL;
+    for(std::uint64_t i=0; i<len; ++i)
+    {
+        h ^= std::uint64_t(static_cast<unsigned char>(bg[i]));
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+std::uint64_t align_up(const std::uint64_t x)
+{
+    return (x + cache_align - 1) / cache_align * cache_align;
+}
+
+} // end of anonymous namespace
+
+
+// write rules to a cache file
+void save_quadrature_rules(const std::string &path,
+        const std::vector<RulePtr> &rules)
+{
+    // layout: header | directory | aligned arrays of each rule
+    std::vector<CacheEntry> dir(rules.size());
+    std::uint64_t offset = align_up(
+            sizeof(CacheHeader) + rules.size() * sizeof(CacheEntry));
+
+    for(unsigned i=0; i<rules.size(); ++i)
+    {
+        dir[i].type = rules[i]->type();
+        dir[i].n = rules[i]->size();
+        dir[i].alpha = rules[i]->alpha();
+        dir[i].beta = rules[i]->beta();
+        dir[i].offset = offset;
+        offset = align_up(offset + (3 * dir[i].n + 1) * sizeof(double));
+    }
+
+    // the whole file in memory, zero-filled so padding is deterministic
+    std::vector<char> buf(offset, 0);
+
+    std::memcpy(&buf[sizeof(CacheHeader)], dir.data(),
+            dir.size() * sizeof(CacheEntry));
+
+    for(unsigned i=0; i<rules.size(); ++i)
+    {
+        const unsigned &n = dir[i].n;
+        char *dst = &buf[dir[i].offset];
+        std::memcpy(dst, rules[i]->coef(), (n + 1) * sizeof(double));
+        std::memcpy(dst + (n + 1) * sizeof(double),
+                rules[i]->nodes(), n * sizeof(double));
+        std::memcpy(dst + (2 * n + 1) * sizeof(double),
+                rules[i]->weights(), n * sizeof(double));
+    }
+
+    CacheHeader header;
+    std::memset(&header, 0, sizeof(CacheHeader));
+    std::memcpy(header.magic, cache_magic, sizeof(cache_magic));
+    header.version = cache_version;
+    header.bom = cache_bom;
+    header.count = rules.size();
+    header.bytes = offset - sizeof(CacheHeader);
+    header.hash = fnv1a(&buf[sizeof(CacheHeader)], header.bytes);
+    std::memcpy(&buf[0], &header, sizeof(CacheHeader));
+
+    // write to a temporary file and then move it to the final name
+    const std::string tmp = path + ".tmp." + std::to_string(::getpid());
+    {
+        std::ofstream f(tmp, std::ios::binary | std::ios::trunc);
+        f.write(buf.data(), buf.size());
+        if (! f) throw PolynomialErrorGeneral(
+                __FL__, "Failed to write quadrature cache file " + tmp + ".");
+    }
+
+    if (std::rename(tmp.c_str(), path.c_str()) != 0)
+    {
+        std::remove(tmp.c_str());
+        throw PolynomialErrorGeneral(
+                __FL__, "Failed to create quadrature cache file " + path + ".");
+    }
+}
+
+// map a cache file and register its rules
+unsigned load_quadrature_rules(const std::string &path)
+{
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return 0;
+
+    struct stat st;
+    if ((::fstat(fd, &st) != 0) ||
+            (std::uint64_t(st.st_size) < sizeof(CacheHeader)))
+    {
+        ::close(fd);
+        return 0;
+    }
+
+    const std::uint64_t size = st.st_size;
+    void *addr = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd); // the mapping stays valid after closing the descriptor
+    if (addr == MAP_FAILED) return 0;
+
+    // the mapping is released when the last rule using it is gone
+    std::shared_ptr<const char> map(static_cast<const char*>(addr),
+            [size](const char *p){ ::munmap(const_cast<char*>(p), size); });
+
+    // validate the header
+    CacheHeader header;
+    std::memcpy(&header, map.get(), sizeof(CacheHeader));
+
+    if (std::memcmp(header.magic, cache_magic, sizeof(cache_magic)) != 0) return 0;
+    if (header.version != cache_version) return 0;
+    if (header.bom != cache_bom) return 0;
+    if (header.bytes != size - sizeof(CacheHeader)) return 0;
+    if (header.count * sizeof(CacheEntry) > header.bytes) return 0;
+    if (fnv1a(map.get() + sizeof(CacheHeader), header.bytes) != header.hash) return 0;
+
+    const CacheEntry *dir =
+        reinterpret_cast<const CacheEntry*>(map.get() + sizeof(CacheHeader));
+
+    unsigned count = 0;
+    for(std::uint64_t i=0; i<header.count; ++i)
+    {
+        const CacheEntry &e = dir[i];
+        const std::uint64_t len = (3 * std::uint64_t(e.n) + 1) * sizeof(double);
+
+        if ((e.offset % cache_align != 0) || (e.offset + len > size)) return count;
+
+        PolyType type = static_cast<PolyType>(e.type);
+        RuleKey key = (type == PolyType::JACOBI) ?
+            RuleKey{type, e.n, e.alpha, e.beta} : RuleKey{type, e.n, 0.0, 0.0};
+
+        std::shared_ptr<const double> data(map,
+                reinterpret_cast<const double*>(map.get() + e.offset));
+
+        RulePtr rule = std::make_shared<QuadratureRule>(
+                key.type, key.n, key.alpha, key.beta, data);
+
+        if (RuleRegistry::instance().insert(key, rule)) count += 1;
+    }
+
+    return count;
+}
+
+} // end of namespace poly
+} // end of namespace simpoly
@@ -0,0 +1,228 @@
+/**
+ * \file tensor_polynomial.cpp
+ * \brief Implementation of the class TensorPolynomial.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# include <algorithm>
+
+# include "exceptions.h"
+# include "tensor_polynomial.h"
+
+
+using namespace simpoly::basic;
+using namespace simpoly::exceptions;
+
+
+namespace simpoly
+{
+namespace poly
+{
+
+namespace
+{
+
+// C (m x n) = A (m x k) * B (k x n), all row-major.
+//
+// This is the only kernel of sum factorization. The innermost loop is an
+// axpy over a contiguous row of B, and four rows of C are updated per row of
+// B, so each load of B feeds four multiply-adds and the loop vectorizes
+// without reductions.
+void contract(const unsigned m, const unsigned n, const unsigned k,
+        const double *A, const double *B, double *C)
+{
+    std::fill(C, C + m * n, 0.0);
+
+    unsigned r = 0;
+
+    for(; r+4<=m; r+=4)
+    {
+        double *c0 = C + r * n, *c1 = c0 + n, *c2 = c1 + n, *c3 = c2 + n;
+        const double *a = A + r * k;
+
+        for(unsigned l=0; l<k; ++l)
+        {
+            const double a0 = a[l], a1 = a[k+l], a2 = a[2*k+l], a3 = a[3*k+l];
+            const double *b = B + l * n;
+
+            for(unsigned j=0; j<n; ++j)
+            {
+                const double bj = b[j];
+                c0[j] += a0 * bj;
+                c1[j] += a1 * bj;
+                c2[j] += a2 * bj;
+                c3[j] += a3 * bj;
+            }
+        }
+    }
+
+    for(; r<m; ++r)
+    {
+        double *c = C + r * n;
+        const double *a = A + r * k;
+
+        for(unsigned l=0; l<k; ++l)
+        {
+            const double al = a[l], *b = B + l * n;
+            for(unsigned j=0; j<n; ++j) c[j] += al * b[j];
+        }
+    }
+}
+
+// values of basis polynomials at points; T[p * n + i] = b_i(x_p), or
+// T[i * m + p] if transposed
+DArry table(const std::vector<Polynomial> &b, const DArry &x, const bool transposed)
+{
+    const unsigned n = b.size(), m = x.size();
+    DArry T(n * m);
+
+    for(unsigned i=0; i<n; ++i)
+    {
+        const DArry v = b[i](x);
+        for(unsigned p=0; p<m; ++p) T[transposed ? (i*m+p) : (p*n+i)] = v[p];
+    }
+
+    return T;
+}
+
+} // end of anonymous namespace
+
+
+// constructor
+TensorPolynomial::TensorPolynomial(const Polynomial &X, const Polynomial &Y):
+    _dim(2), _basis{{X}, {Y}, {}}, _coef(1, 1.0) { _setup(); }
+
+// constructor
+TensorPolynomial::TensorPolynomial(const Polynomial &X, const Polynomial &Y,
+        const Polynomial &Z):
+    _dim(3), _basis{{X}, {Y}, {Z}}, _coef(1, 1.0) { _setup(); }
+
+// constructor
+TensorPolynomial::TensorPolynomial(const std::vector<Polynomial> &X,
+        const std::vector<Polynomial> &Y, const DArry &coef):
+    _dim(2), _basis{X, Y, {}}, _coef(coef) { _setup(); }
+
+// constructor
+TensorPolynomial::TensorPolynomial(const std::vector<Polynomial> &X,
+        const std::vector<Polynomial> &Y, const std::vector<Polynomial> &Z,
+        const DArry &coef):
+    _dim(3), _basis{X, Y, Z}, _coef(coef) { _setup(); }
+
+// getters
+unsigned TensorPolynomial::dim() const { return _dim; }
+
+const std::vector<Polynomial> &TensorPolynomial::basis(const unsigned axis) const
+{
+    if (axis >= _dim) throw PolynomialErrorGeneral(__FL__,
+            "The axis exceeds the number of dimensions.");
+    return _basis[axis];
+}
+
+const DArry &TensorPolynomial::coef() const { return _coef; }
+
+// point evaluation
+double TensorPolynomial::operator()(const double x, const double y) const
+{ return evaluate(DArry(1, x), DArry(1, y))[0]; }
+
+// point evaluation
+double TensorPolynomial::operator()(const double x, const double y, const double z) const
+{ return evaluate(DArry(1, x), DArry(1, y), DArry(1, z))[0]; }
+
+// evaluation on a 2D grid
+DArry TensorPolynomial::evaluate(const DArry &x, const DArry &y) const
+{
+    if (_dim != 2) throw UnmatchedLength(__FL__, _dim, 2);
+
+    DArry u;
+    _grid(x, y, DArry(1, 0.0), &u, nullptr, nullptr, nullptr);
+    return u;
+}
+
+// evaluation on a 3D grid
+DArry TensorPolynomial::evaluate(const DArry &x, const DArry &y, const DArry &z) const
+{
+    if (_dim != 3) throw UnmatchedLength(__FL__, _dim, 3);
+
+    DArry u;
+    _grid(x, y, z, &u, nullptr, nullptr, nullptr);
+    return u;
+}
+
+// gradients on a 2D grid
+void TensorPolynomial::gradient(const DArry &x, const DArry &y,
+        DArry &u, DArry &ux, DArry &uy) const
+{
+    if (_dim != 2) throw UnmatchedLength(__FL__, _dim, 2);
+
+    _grid(x, y, DArry(1, 0.0), &u, &ux, &uy, nullptr);
+}
+
+// gradients on a 3D grid
+void TensorPolynomial::gradient(const DArry &x, const DArry &y, const DArry &z,
+        DArry &u, DArry &ux, DArry &uy, DArry &uz) const
+{
+    if (_dim != 3) throw UnmatchedLength(__FL__, _dim, 3);
+
+    _grid(x, y, z, &u, &ux, &uy, &uz);
+}
+
+// check sizes and differentiate bases
+void TensorPolynomial::_setup()
+{
+    // a 2D polynomial is a 3D one constant in z
+    if (_dim == 2) _basis[2].assign(1, Polynomial(DArry(1, 1.0)));
+
+    const unsigned n = _basis[0].size() * _basis[1].size() * _basis[2].size();
+    if (n != _coef.size()) throw UnmatchedLength(__FL__, n, _coef.size());
+
+    for(unsigned a=0; a<3; ++a)
+    {
+        _dbasis[a].clear();
+        for(const auto &it: _basis[a]) _dbasis[a].push_back(it.deriv());
+    }
+}
+
+// sum factorization: x first, then y, then z
+void TensorPolynomial::_grid(const DArry &x, const DArry &y, const DArry &z,
+        DArry *u, DArry *ux, DArry *uy, DArry *uz) const
+{
+    const unsigned nx = _basis[0].size(), ny = _basis[1].size(), nz = _basis[2].size(),
+                   mx = x.size(), my = y.size(), mz = z.size();
+
+    // contraction in x: (nz * ny) x nx times nx x mx
+    auto step_x = [&](const DArry &X)->DArry {
+        DArry T(nz * ny * mx);
+        contract(nz * ny, mx, nx, _coef.data(), X.data(), T.data());
+        return T;
+    };
+
+    // contraction in y, one z-slice at a time: my x ny times ny x mx
+    auto step_y = [&](const DArry &Y, const DArry &in)->DArry {
+        DArry T(nz * my * mx);
+        for(unsigned k=0; k<nz; ++k)
+            contract(my, mx, ny, Y.data(), in.data() + k * ny * mx, T.data() + k * my * mx);
+        return T;
+    };
+
+    // contraction in z: mz x nz times nz x (my * mx)
+    auto step_z = [&](const DArry &Z, const DArry &in, DArry &out) {
+        out.resize(mz * my * mx);
+        contract(mz, my * mx, nz, Z.data(), in.data(), out.data());
+    };
+
+    const DArry X = table(_basis[0], x, true),
+                Y = table(_basis[1], y, false),
+                Z = table(_basis[2], z, false);
+
+    const DArry Tx = step_x(X), Txy = step_y(Y, Tx);
+
+    if (u) step_z(Z, Txy, *u);
+    if (uz) step_z(table(_dbasis[2], z, false), Txy, *uz);
+    if (uy) step_z(Z, step_y(table(_dbasis[1], y, false), Tx), *uy);
+    if (ux) step_z(Z, step_y(Y, step_x(table(_dbasis[0], x, true))), *ux);
+}
+
+} // end of namespace poly
+} // end of namespace simpoly
@@ -0,0 +1,152 @@
+/**
+ * \file tracker.cpp
+ * \brief Implementation of the class RootTracker.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# include <algorithm>
+# include <cmath>
+# include <limits>
+
+# include "exceptions.h"
+# include "tracker.h"
+
+
+using namespace simpoly::basic;
+
+
+namespace simpoly
+{
+namespace poly
+{
+
+// constructor
+RootTracker::RootTracker(const double tol, const unsigned max_sweeps):
+    _tol(tol), _max_sweeps(max_sweeps) {}
+
+// roots of the next polynomial
+const CArry &RootTracker::update(const DArry &coeffs)
+{
+    CHECK_COEFS(coeffs, 1e-12);
+
+    const CArry C = to_CArry(coeffs);
+
+    // warm start only if the degree is unchanged
+    _sweeps = (_roots.size() + 1 == C.size()) ? _warm(C) : 0;
+    _rebuilt = (_sweeps == 0);
+
+    if (_rebuilt) _rebuild(C);
+
+    _expand();
+    return _roots;
+}
+
+// roots of the next polynomial
+const CArry &RootTracker::update(const Polynomial &p) { return update(p.coef()); }
+
+// start cold next time
+void RootTracker::reset()
+{
+    _distinct.clear();
+    _mult.clear();
+    _roots.clear();
+    _sweeps = 0;
+    _rebuilt = false;
+}
+
+// getters
+const CArry &RootTracker::roots() const { return _roots; }
+const CArry &RootTracker::distinct_roots() const { return _distinct; }
+const std::vector<unsigned> &RootTracker::multiplicities() const { return _mult; }
+unsigned RootTracker::sweeps() const { return _sweeps; }
+bool RootTracker::rebuilt() const { return _rebuilt; }
+
+// Gauss-Seidel Aberth sweeps weighted by multiplicities
+unsigned RootTracker::_warm(const CArry &coeffs)
+{
+    const unsigned n = _distinct.size();
+    const double eps = std::numeric_limits<double>::epsilon();
+
+    // the roots are constant if the polynomial is
+    if (n == 0) return 1;
+
+    DArry absc(coeffs.size());
+    for(unsigned k=0; k<coeffs.size(); ++k) absc[k] = std::abs(coeffs[k]);
+
+    CArry z(_distinct);
+    std::vector<bool> done(n, false);
+
+    unsigned iter = 1;
+    for(; iter<=_max_sweeps; ++iter)
+    {
+        bool all = true;
+
+        for(unsigned j=0; j<n; ++j)
+        {
+            if (done[j]) continue;
+
+            Cmplx d, p = evaluate_with_derivative(coeffs, z[j], d);
+
+            // p(z) at the rounding level of Horner's scheme
+            const double level = 4.0 * coeffs.size() * eps * evaluate(absc, std::abs(z[j]));
+            if (std::abs(p) <= level) { done[j] = true; continue; }
+
+            Cmplx S = 0.0;
+            for(unsigned k=0; k<n; ++k) if (k != j) S += double(_mult[k]) / (z[j] - z[k]);
+
+            const Cmplx den = d - p * S;
+            if (den == 0.0) return 0;
+
+            const Cmplx delta = double(_mult[j]) * p / den;
+            z[j] -= delta;
+
+            if (std::abs(delta) <= _tol * std::abs(z[j])) done[j] = true;
+            else all = false;
+        }
+
+        if (all) break;
+    }
+
+    // no convergence: the multiplicity structure has probably changed
+    if (iter > _max_sweeps) return 0;
+
+    // two distinct roots merging into a multiple one
+    const double close = std::sqrt(_tol);
+    for(unsigned j=0; j<n; ++j)
+        for(unsigned k=j+1; k<n; ++k)
+            if (std::abs(z[j] - z[k]) <= close * std::max(1.0, std::abs(z[j])))
+                return 0;
+
+    _distinct = z;
+    return iter;
+}
+
+// cold start
+void RootTracker::_rebuild(const CArry &coeffs)
+{
+    const CArry all = yan_and_chieng_2006(coeffs, _tol);
+
+    // multiple roots are returned as consecutive identical copies
+    _distinct.clear();
+    _mult.clear();
+    for(unsigned i=0; i<all.size(); ++i)
+    {
+        if ((i > 0) && (all[i] == all[i-1])) { _mult.back() += 1; continue; }
+
+        _distinct.push_back(all[i]);
+        _mult.push_back(1);
+    }
+}
+
+// repeat distinct roots by multiplicities
+void RootTracker::_expand()
+{
+    _roots.clear();
+    for(unsigned j=0; j<_distinct.size(); ++j)
+        _roots.insert(_roots.end(), _mult[j], _distinct[j]);
+}
+
+} // end of namespace poly
+} // end of namespace simpoly
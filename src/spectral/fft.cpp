@@ -0,0 +1,181 @@
+/**
+ * \file fft.cpp
+ * \brief Implementation of the internal FFT and DCT-I.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# include <algorithm>
+# include <cmath>
+
+# include "../fft.h"
+
+
+using namespace simpoly::basic;
+
+
+namespace simpoly
+{
+namespace fft
+{
+
+namespace
+{
+
+const double pi = std::acos(-1.0);
+
+bool power_of_two(const unsigned n) { return (n & (n - 1)) == 0; }
+
+// iterative radix-2 transform; n must be a power of two
+void radix2(CArry &a, const bool inverse)
+{
+    const unsigned n = a.size();
+    if (n < 2) return;
+
+    // bit-reversal permutation
+    for(unsigned i=1, j=0; i<n; ++i)
+    {
+        unsigned bit = n >> 1;
+        for(; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) std::swap(a[i], a[j]);
+    }
+
+    // forward twiddle factors, computed directly rather than by repeated
+    // multiplication, and kept for the largest length seen by this thread;
+    // those of a shorter length r n are every r-th entry (bitwise the same,
+    // as 2 pi j r / (n r) only scales by a power of two)
+    static thread_local CArry table;
+    if (table.size() < n / 2)
+    {
+        table.resize(n / 2);
+        for(unsigned j=0; j<n/2; ++j) table[j] = std::polar(1.0, -2.0 * pi * j / n);
+    }
+    const unsigned r = 2 * table.size() / n;
+    const double sign = inverse ? -1.0 : 1.0;
+
+    for(unsigned len=2; len<=n; len<<=1)
+    {
+        const unsigned half = len / 2, stride = r * n / len;
+
+        for(unsigned s=0; s<n; s+=len)
+            for(unsigned j=0; j<half; ++j)
+            {
+                // in real arithmetic, which skips the NaN recovery of
+                // std::complex products
+                const double wr = table[j*stride].real(), wi = sign * table[j*stride].imag();
+                const double ur = a[s+j].real(), ui = a[s+j].imag();
+                const double xr = a[s+j+half].real(), xi = a[s+j+half].imag();
+                const double vr = xr * wr - xi * wi, vi = xr * wi + xi * wr;
+                a[s+j] = Cmplx(ur + vr, ui + vi);
+                a[s+j+half] = Cmplx(ur - vr, ui - vi);
+            }
+    }
+}
+
+// Bluestein: jk = (j^2 + k^2 - (k-j)^2) / 2 turns the DFT into a convolution
+void bluestein(CArry &a, const bool inverse)
+{
+    const unsigned n = a.size();
+
+    unsigned m = 1;
+    while (m < 2 * n - 1) m <<= 1;
+
+    // chirp exp(-+ pi i j^2 / n), with j^2 reduced modulo 2n for accuracy
+    const double sign = inverse ? 1.0 : -1.0;
+    CArry chirp(n);
+    for(unsigned long long j=0; j<n; ++j)
+        chirp[j] = std::polar(1.0, sign * pi * double((j * j) % (2ULL * n)) / n);
+
+    CArry A(m, 0.0), B(m, 0.0);
+    for(unsigned j=0; j<n; ++j) A[j] = a[j] * chirp[j];
+
+    B[0] = std::conj(chirp[0]);
+    for(unsigned j=1; j<n; ++j) B[j] = B[m-j] = std::conj(chirp[j]);
+
+    radix2(A, false);
+    radix2(B, false);
+    for(unsigned k=0; k<m; ++k) A[k] *= B[k];
+    radix2(A, true);
+
+    for(unsigned k=0; k<n; ++k) a[k] = chirp[k] * A[k] / double(m);
+}
+
+} // end of anonymous namespace
+
+
+// DFT of any length
+void fft(CArry &a, const bool inverse)
+{
+    const unsigned n = a.size();
+    if (n < 2) return;
+
+    if (power_of_two(n)) radix2(a, inverse);
+    else bluestein(a, inverse);
+
+    if (inverse) for(auto &it: a) it /= double(n);
+}
+
+// DCT-I through the even extension of length 2N
+void dct1(DArry &v)
+{
+    const unsigned N = v.size() - 1;
+
+    CArry a(2 * N);
+    for(unsigned j=0; j<=N; ++j) a[j] = v[j];
+    for(unsigned j=1; j<N; ++j) a[2*N-j] = v[j];
+
+    fft(a);
+
+    for(unsigned k=0; k<=N; ++k) v[k] = a[k].real();
+}
+
+// real convolution with one complex transform
+DArry convolve(const DArry &a, const DArry &b)
+{
+    const unsigned n = a.size() + b.size() - 1;
+
+    unsigned m = 1;
+    while (m < n) m <<= 1;
+
+    // both scaled to unit maximum, or rounding errors of the larger one
+    // swamp the other when they are split
+    double sa = 0.0, sb = 0.0;
+    for(const auto &it: a) sa = std::max(sa, std::abs(it));
+    for(const auto &it: b) sb = std::max(sb, std::abs(it));
+    if ((sa == 0.0) || (sb == 0.0)) return DArry(n, 0.0);
+
+    CArry z(m, 0.0);
+    for(unsigned j=0; j<a.size(); ++j) z[j].real(a[j] / sa);
+    for(unsigned j=0; j<b.size(); ++j) z[j].imag(b[j] / sb);
+
+    radix2(z, false);
+
+    // A_k = (Z_k + conj Z_{-k}) / 2 and B_k = (Z_k - conj Z_{-k}) / 2i
+    CArry c(m);
+    for(unsigned k=0; k<m; ++k)
+    {
+        const Cmplx zk = z[k], zc = std::conj(z[(m - k) & (m - 1)]);
+        c[k] = (zk + zc) * (zk - zc) * Cmplx(0.0, -0.25);
+    }
+
+    radix2(c, true);
+
+    DArry r(n);
+    for(unsigned j=0; j<n; ++j) r[j] = c[j].real() * (sa * sb / m);
+
+    return r;
+}
+
+
+bool use_fft(const unsigned na, const unsigned nb)
+{
+    unsigned N = 1, logN = 0;
+    while (N < na + nb - 1) { N <<= 1; ++logN; }
+
+    return double(na) * nb > 6.0 * N * logN;
+}
+
+} // end of namespace fft
+} // end of namespace simpoly
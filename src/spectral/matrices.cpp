@@ -0,0 +1,178 @@
+/**
+ * \file matrices.cpp
+ * \brief Implementation of pseudospectral matrix builders.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# include <algorithm>
+# include <cmath>
+
+# include "exceptions.h"
+# include "quadrature.h"
+# include "spectral.h"
+# include "../barycentric.h"
+# include "../parallel.h"
+
+
+using namespace simpoly::basic;
+using namespace simpoly::exceptions;
+
+
+namespace simpoly
+{
+namespace spectral
+{
+
+namespace
+{
+
+// fill `row` with l_j(y) for all j, using barycentric weights w
+void interpolation_row(const DArry &x, const DArry &w, const double y, double *row)
+{
+    const unsigned n = x.size();
+
+    double sum = 0.0;
+    for(unsigned j=0; j<n; ++j)
+    {
+        double diff = y - x[j];
+
+        // y coincides with a node: the row is a unit vector
+        if (diff == 0.0)
+        {
+            std::fill(row, row+n, 0.0);
+            row[j] = 1.0;
+            return;
+        }
+
+        row[j] = w[j] / diff;
+        sum += row[j];
+    }
+
+    for(unsigned j=0; j<n; ++j) row[j] /= sum;
+}
+
+} // end of anonymous namespace
+
+
+// barycentric weights
+DArry barycentric_weights(const DArry &nodes)
+{
+    if (nodes.size() == 0) throw ZeroCoeffsLength(__FL__);
+
+    const double scale = barycentric::capacity_scale(nodes);
+
+    DArry x, w;
+    x.reserve(nodes.size());
+    w.reserve(nodes.size());
+    for(const auto &it: nodes) barycentric::add_node(x, w, scale, it);
+
+    return w;
+}
+
+
+// differentiation matrix
+void differentiation_matrix(const DArry &nodes, double *D, const unsigned nthreads)
+{
+    const unsigned n = nodes.size();
+    const DArry w = barycentric_weights(nodes);
+
+    parallel::for_range(n, nthreads, [&](unsigned bg, unsigned ed)
+    {
+        for(unsigned i=bg; i<ed; ++i)
+        {
+            double *row = D + std::size_t(i) * n;
+            double diag = 0.0;
+
+            for(unsigned j=0; j<n; ++j)
+            {
+                if (j == i) continue;
+                row[j] = (w[j] / w[i]) / (nodes[i] - nodes[j]);
+                diag -= row[j]; // rows of D sum to zero
+            }
+
+            row[i] = diag;
+        }
+    });
+}
+
+// differentiation matrix
+DArry differentiation_matrix(const DArry &nodes, const unsigned nthreads)
+{
+    DArry D(nodes.size() * nodes.size());
+    differentiation_matrix(nodes, D.data(), nthreads);
+    return D;
+}
+
+
+// interpolation matrix
+void interpolation_matrix(const DArry &nodes, const DArry &y,
+        double *M, const unsigned nthreads)
+{
+    const unsigned n = nodes.size();
+    const DArry w = barycentric_weights(nodes);
+
+    parallel::for_range(y.size(), nthreads, [&](unsigned bg, unsigned ed)
+    {
+        for(unsigned k=bg; k<ed; ++k)
+            interpolation_row(nodes, w, y[k], M + std::size_t(k) * n);
+    });
+}
+
+// interpolation matrix
+DArry interpolation_matrix(const DArry &nodes, const DArry &y,
+        const unsigned nthreads)
+{
+    DArry M(y.size() * nodes.size());
+    interpolation_matrix(nodes, y, M.data(), nthreads);
+    return M;
+}
+
+
+// integration matrix
+void integration_matrix(const DArry &nodes, double *S,
+        const double a, const unsigned nthreads)
+{
+    const unsigned n = nodes.size();
+    const DArry w = barycentric_weights(nodes);
+
+    // m Gauss-Legendre nodes integrate degree 2m-1 >= n-1 exactly
+    poly::RulePtr rule = poly::quadrature_rule(poly::PolyType::LEGENDRE, n/2+1);
+    const unsigned m = rule->size();
+    const double *t = rule->nodes();
+    const double *tw = rule->weights();
+
+    parallel::for_range(n, nthreads, [&](unsigned bg, unsigned ed)
+    {
+        DArry l(n); // per-thread scratch holding l_j at one quadrature point
+
+        for(unsigned i=bg; i<ed; ++i)
+        {
+            double *row = S + std::size_t(i) * n;
+            const double half = 0.5 * (nodes[i] - a);
+
+            std::fill(row, row+n, 0.0);
+
+            for(unsigned q=0; q<m; ++q)
+            {
+                interpolation_row(nodes, w, a + half * (t[q] + 1.0), l.data());
+
+                const double c = half * tw[q];
+                for(unsigned j=0; j<n; ++j) row[j] += c * l[j];
+            }
+        }
+    });
+}
+
+// integration matrix
+DArry integration_matrix(const DArry &nodes, const double a,
+        const unsigned nthreads)
+{
+    DArry S(nodes.size() * nodes.size());
+    integration_matrix(nodes, S.data(), a, nthreads);
+    return S;
+}
+
+} // end of namespace spectral
+} // end of namespace simpoly
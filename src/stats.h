@@ -0,0 +1,43 @@
+/**
+ * \file stats.h
+ * \brief Internal hooks filling RootStats (active with SIMPOLY_ROOT_STATS).
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# pragma once
+
+# include "basic.h"
+
+
+namespace simpoly
+{
+namespace basic
+{
+
+/**
+ * \brief The RootStats registered on this thread.
+ *
+ * \return A pointer to the statistics, or nullptr if no scope is active.
+ */
+RootStats *&current_stats();
+
+} // end of namespace basic
+} // end of namespace simpoly
+
+
+# ifdef SIMPOLY_ROOT_STATS
+
+    // run the statements with `s` bound to the active RootStats, if any
+    # define SIMPOLY_STATS(s, ...) \
+    do { \
+        if (simpoly::basic::RootStats *s = simpoly::basic::current_stats()) \
+        { __VA_ARGS__; } \
+    } while (0)
+
+# else
+
+    # define SIMPOLY_STATS(s, ...) do {} while (0)
+
+# endif
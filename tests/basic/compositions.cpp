@@ -0,0 +1,148 @@
+/**
+ * \file compositions.cpp
+ * \brief Unit tests for Taylor shifts and compositions.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+
+# include <cmath>
+
+# include <gtest/gtest.h>
+
+# include "basic.h"
+# include "exceptions.h"
+
+using namespace simpoly;
+
+// coefficients of a testing polynomial of degree n-1
+static basic::DArry testing_coeffs(const unsigned n)
+{
+    basic::DArry c(n);
+    for(unsigned i=0; i<n; ++i) c[i] = std::sin(1.0 + i);
+    return c;
+}
+
+
+TEST(TaylorShift, Horner)
+{
+    // 1 + 2x + 3x^2 at x + 2 is 17 + 14x + 3x^2
+    ASSERT_EQ(basic::DArry({17.0, 14.0, 3.0}),
+            basic::taylor_shift(basic::DArry({1.0, 2.0, 3.0}), 2.0));
+
+    // x^2 at x + i is -1 + 2i x + x^2
+    basic::CArry c = basic::taylor_shift(basic::CArry({0.0, 0.0, 1.0}), basic::Cmplx(0.0, 1.0));
+    ASSERT_EQ(basic::CArry({-1.0, basic::Cmplx(0.0, 2.0), 1.0}), c);
+
+    basic::DArry p = testing_coeffs(12), q = basic::taylor_shift(p, -0.7);
+    for(double x=-1.0; x<=1.0; x+=0.125)
+        ASSERT_NEAR(basic::evaluate(p, x - 0.7), basic::evaluate(q, x), 1e-12);
+}
+
+
+TEST(TaylorShift, Fast)
+{
+    for(unsigned n: {1u, 2u, 40u, 65u, 200u, 513u})
+    {
+        const basic::DArry p = testing_coeffs(n);
+
+        for(double a: {0.0, -0.4, 0.25})
+        {
+            const basic::DArry expect = basic::taylor_shift(p, a),
+                               result = basic::taylor_shift_fast(p, a);
+
+            ASSERT_EQ(expect.size(), result.size());
+
+            double scale = 0.0;
+            for(const auto &it: expect) scale = std::max(scale, std::abs(it));
+
+            for(unsigned i=0; i<n; ++i)
+                ASSERT_NEAR(expect[i], result[i], 1e-13 * scale);
+        }
+    }
+}
+
+
+TEST(TaylorShift, Batch)
+{
+    const basic::DArry p = testing_coeffs(9), a({-1.5, -0.2, 0.0, 0.3, 2.0});
+    basic::DArry out(a.size() * p.size());
+
+    basic::taylor_shift(p, a.size(), a.data(), out.data());
+
+    for(unsigned q=0; q<a.size(); ++q)
+        ASSERT_EQ(basic::taylor_shift(p, a[q]),
+                basic::DArry(out.begin() + q * p.size(), out.begin() + (q + 1) * p.size()));
+}
+
+
+TEST(ComposeAffine, ReferenceToPhysical)
+{
+    // p on [-1, 1] mapped to [a, b]
+    const double a = 2.0, b = 5.0;
+    const basic::DArry p = testing_coeffs(8),
+          q = basic::compose_affine(p, 2.0 / (b - a), -(a + b) / (b - a));
+
+    for(double x=-1.0; x<=1.0; x+=0.25)
+        ASSERT_NEAR(basic::evaluate(p, x),
+                basic::evaluate(q, 0.5 * (a + b) + 0.5 * (b - a) * x), 1e-11);
+
+    // a vanishing scale leaves the constant p(t)
+    basic::DArry c = basic::compose_affine(p, 0.0, 0.5);
+    ASSERT_EQ(1u, c.size());
+    ASSERT_NEAR(basic::evaluate(p, 0.5), c[0], 1e-14);
+}
+
+
+// p(q(x)) by Horner's scheme with polynomial products
+static basic::DArry compose_horner(const basic::DArry &p, const basic::DArry &q)
+{
+    basic::DArry r(1, p.back());
+    for(unsigned i=p.size()-1; i-->0; )
+    {
+        basic::DArry t(r.size() + q.size() - 1, 0.0);
+        for(unsigned a=0; a<r.size(); ++a)
+            for(unsigned b=0; b<q.size(); ++b)
+                t[a+b] += r[a] * q[b];
+        t[0] += p[i];
+        r.swap(t);
+    }
+    return r;
+}
+
+
+TEST(Compose, Small)
+{
+    // (x^2 + 1)^2 - 2 (x^2 + 1) + 3 = x^4 + 2
+    ASSERT_EQ(basic::DArry({2.0, 0.0, 0.0, 0.0, 1.0}),
+            basic::compose(basic::DArry({3.0, -2.0, 1.0}), basic::DArry({1.0, 0.0, 1.0})));
+
+    // constant inner or outer polynomials
+    ASSERT_EQ(basic::DArry({6.0}),
+            basic::compose(basic::DArry({3.0, -2.0, 1.0}), basic::DArry({3.0})));
+    ASSERT_EQ(basic::DArry({3.0}),
+            basic::compose(basic::DArry({3.0}), basic::DArry({1.0, 0.0, 1.0})));
+}
+
+
+TEST(Compose, BabyStepGiantStep)
+{
+    for(unsigned n: {2u, 5u, 17u, 64u, 150u})
+        for(unsigned m: {1u, 2u, 7u})
+        {
+            basic::DArry p = testing_coeffs(n+1), q(m+1);
+            for(unsigned i=0; i<=m; ++i) q[i] = std::cos(2.0 + i) / (m + 1);
+
+            const basic::DArry expect = compose_horner(p, q);
+            basic::DArry result(n * m + 1, -1.0); // stale values are overwritten
+            basic::compose(p, q, result.data());
+
+            double scale = 0.0;
+            for(const auto &it: expect) scale = std::max(scale, std::abs(it));
+
+            ASSERT_EQ(expect.size(), result.size());
+            for(unsigned i=0; i<expect.size(); ++i)
+                ASSERT_NEAR(expect[i], result[i], 1e-13 * scale);
+        }
+}
@@ -7,6 +7,7 @@
  */
 
 
+# include <cmath>
 # include <random>
 
 # include <gtest/gtest.h>
@@ -296,3 +297,23 @@ TEST(PolynomialEvaluation, RealRootPolyValarray)
         ASSERT_NEAR(expect[i], result, 1e-12);
     }
 }
+
+TEST(PolynomialEvaluation, Compensated)
+{
+    // (x - 1)^9 expanded: plain Horner's scheme returns only rounding noise
+    basic::DArry c({-1., 9., -36., 84., -126., 126., -84., 36., -9., 1.});
+
+    for(const double x: {0.99, 1.01, 1.02})
+    {
+        const double expect = std::pow(x - 1.0, 9); // x - 1 is exact here
+        ASSERT_GT(std::abs(basic::evaluate(c, x) - expect), 1e-3 * std::abs(expect));
+        ASSERT_NEAR(expect, basic::evaluate_compensated(c, x), 1e-10 * std::abs(expect));
+        ASSERT_EQ(basic::evaluate_compensated(c, x),
+                basic::evaluate(c, x, basic::Accuracy::COMPENSATED));
+        ASSERT_EQ(basic::evaluate(c, x), basic::evaluate(c, x, basic::Accuracy::STANDARD));
+    }
+
+    const basic::CArry C = basic::to_CArry(c);
+    const basic::Cmplx z(1.0, 0.01), expect = std::pow(z - 1.0, 9);
+    ASSERT_NEAR(0.0, std::abs(basic::evaluate_compensated(C, z) - expect), 1e-10 * std::abs(expect));
+}
@@ -35,6 +35,21 @@ static auto f = [](basic::Cmplx i, basic::Cmplx j)->bool {
 
 static auto f2 = [](basic::Cmplx i, basic::Cmplx j)->bool{return i.real()<j.real();};
 
+// |p(z)| relative to the scale of its terms; roots outside the unit disk are
+// checked on the reversed polynomial at 1 / z, where nothing overflows
+static double relative_residual(const basic::CArry &c, const basic::Cmplx &z)
+{
+    const bool out = std::abs(z) > 1.0;
+    const basic::CArry rc(c.rbegin(), c.rend());
+    const basic::CArry &cc = out ? rc : c;
+    const basic::Cmplx x = out ? 1.0 / z : z;
+
+    double scale = 0.0;
+    for(unsigned k=0; k<cc.size(); ++k) scale += std::abs(cc[k]) * std::pow(std::abs(x), k);
+
+    return std::abs(basic::evaluate(cc, x)) / scale;
+}
+
 # ifndef NDEBUG
 TEST(PolynomialRoots, CheckExceptions)
 {
@@ -551,3 +566,586 @@ TEST(PolynomialRoots, MultiRealRootsYC2)
 }
 
 // TODO: add tests for roots of low-degree polynomials
+
+TEST(PolynomialRoots, SimultaneousAberth1)
+{
+    basic::DArry c({
+            0.5808674560998166, -0.6495173545341641,  0.2415758641182864,
+            -0.5399634531874522, -0.1987466764202912,  0.524098092459949 ,
+            0.9492147992555258, -0.8465445984978208, -0.2634181317553206 });
+
+    basic::CArry expect({
+            basic::Cmplx(-3.9897450303048148, 0.),
+            basic::Cmplx(-0.8870172577239701, -0.566285872801541),
+            basic::Cmplx(-0.8870172577239701, 0.566285872801541),
+            basic::Cmplx(-0.0269354166777918, -0.7935763762618989),
+            basic::Cmplx(-0.0269354166777918, 0.7935763762618989),
+            basic::Cmplx(0.8661900415687693, 0.),
+            basic::Cmplx(0.8688844424396298, -0.3985703106289106),
+            basic::Cmplx(0.8688844424396298, 0.3985703106289106)});
+
+    basic::CArry result = basic::aberth_simultaneous(c);
+
+    // sort `expect` and `result` so we can compare them term by term
+    std::sort(std::begin(expect), std::end(expect), f);
+    std::sort(std::begin(result), std::end(result), f);
+
+    for(unsigned i=0; i<expect.size(); ++i)
+    {
+        ASSERT_NEAR(expect[i].real(), result[i].real(), 1e-10);
+        ASSERT_NEAR(expect[i].imag(), result[i].imag(), 1e-10);
+    }
+}
+
+TEST(PolynomialRoots, SimultaneousAberth2)
+{
+    // x^n - 1, whose roots are the n-th roots of unity
+    const unsigned n = 157;
+    basic::CArry c(n+1, 0.0);
+    c[0] = -1.0;
+    c[n] = 1.0;
+
+    basic::CArry guess(n);
+    for(unsigned i=0; i<n; ++i)
+        guess[i] = 1.3 * std::exp(basic::Cmplx(0.0, 2.0 * M_PI * (i + 0.25) / n));
+
+    basic::CArry r1 = basic::aberth_simultaneous(c, guess, 1e-12);
+    basic::CArry r4 = basic::aberth_simultaneous(c, guess, 1e-12, 4);
+
+    for(unsigned i=0; i<n; ++i)
+    {
+        // threads only split the work; results are identical
+        ASSERT_EQ(r1[i], r4[i]);
+        ASSERT_NEAR(1.0, std::abs(r1[i]), 1e-12);
+        ASSERT_NEAR(0.0, std::abs(std::pow(r1[i], double(n)) - 1.0), 1e-10);
+    }
+
+    // all roots are distinct
+    std::sort(std::begin(r1), std::end(r1), f);
+    for(unsigned i=1; i<n; ++i) ASSERT_GT(std::abs(r1[i] - r1[i-1]), 1e-3);
+}
+
+TEST(PolynomialRoots, SimultaneousAberth3)
+{
+    // random complex coefficients of high degree: |p(z)|^2 and |p'(z)|^2
+    // overflow, and iterates outside the unit disk overflow p(z) itself
+    for(const unsigned n: {300u, 800u})
+    {
+        basic::CArry c(n+1);
+        for(auto &it: c) it = basic::Cmplx(drand(generator), drand(generator));
+
+        basic::CArry result = basic::aberth_simultaneous(c);
+        ASSERT_EQ(n, result.size());
+
+        for(const auto &it: result)
+        {
+            ASSERT_TRUE(std::isfinite(it.real()) && std::isfinite(it.imag()));
+            ASSERT_LT(relative_residual(c, it), 1e-11);
+        }
+    }
+}
+
+TEST(PolynomialRoots, AberthActiveSet)
+{
+    // a cluster of three close roots and well separated ones
+    basic::CArry c = basic::to_coefficients(basic::Cmplx(1.0), basic::CArry({
+                0.3, 0.301, 0.302, -0.9, -0.5, 0.1, 0.7, 0.9}));
+
+    basic::CArry guess(c.size()-1);
+    for(unsigned i=0; i<guess.size(); ++i)
+        guess[i] = std::pow(basic::Cmplx(0.5, 0.5), double(i));
+
+    std::vector<unsigned> iters;
+    basic::CArry result = basic::aberth(c, guess, iters, 1e-10);
+
+    ASSERT_EQ(guess.size(), iters.size());
+
+    // separated roots converge long before the clustered ones do
+    unsigned max_iter = *std::max_element(iters.begin(), iters.end());
+    unsigned min_iter = *std::min_element(iters.begin(), iters.end());
+    ASSERT_GE(min_iter, 1u);
+    ASSERT_LT(2 * min_iter, max_iter);
+
+    // same roots as the version without iteration counts
+    basic::CArry expect = basic::aberth(c, guess, 1e-10);
+    for(unsigned i=0; i<expect.size(); ++i) ASSERT_EQ(expect[i], result[i]);
+
+    for(const auto &it: result)
+        ASSERT_NEAR(0.0, std::abs(basic::evaluate(c, it)), 1e-10);
+}
+
+TEST(PolynomialRoots, NewtonPolygonGuess)
+{
+    // roots spread over six orders of magnitude
+    basic::CArry rts(13);
+    for(unsigned i=0; i<rts.size(); ++i) rts[i] = std::pow(10.0, -3.0 + 0.5 * i);
+    basic::CArry c = basic::to_coefficients(basic::Cmplx(1.0), rts);
+
+    // guesses lie on circles matching the moduli of roots
+    basic::CArry guess = basic::initial_guess(c);
+    ASSERT_EQ(rts.size(), guess.size());
+    std::sort(std::begin(guess), std::end(guess),
+            [](basic::Cmplx a, basic::Cmplx b) { return std::abs(a) < std::abs(b); });
+    for(unsigned i=0; i<rts.size(); ++i)
+    {
+        ASSERT_LT(std::abs(guess[i]), 10.0 * std::abs(rts[i]));
+        ASSERT_GT(std::abs(guess[i]), 0.1 * std::abs(rts[i]));
+    }
+
+    // the previous default guesses
+    basic::CArry old(rts.size());
+    for(unsigned i=0; i<old.size(); ++i)
+        old[i] = std::pow(basic::Cmplx(0.5, 0.5), double(i));
+
+    std::vector<unsigned> it1, it2;
+    basic::CArry r1 = basic::aberth(c, basic::initial_guess(c), it1, 1e-10);
+    basic::CArry r2 = basic::aberth(c, old, it2, 1e-10);
+
+    ASSERT_LT(*std::max_element(it1.begin(), it1.end()),
+              *std::max_element(it2.begin(), it2.end()));
+
+    std::sort(std::begin(r1), std::end(r1), f);
+    for(unsigned i=0; i<rts.size(); ++i)
+        ASSERT_NEAR(0.0, std::abs(r1[i] - rts[i]) / std::abs(rts[i]), 1e-8);
+}
+
+TEST(PolynomialRoots, CompanionRoots)
+{
+    // real and complex-conjugate roots of different magnitudes
+    basic::CArry expect({
+            basic::Cmplx(-0.9, 0.0), basic::Cmplx(-0.35, 0.0),
+            basic::Cmplx(0.01, 0.0), basic::Cmplx(0.4, 0.0),
+            basic::Cmplx(2.5, 0.0), basic::Cmplx(-0.2, -1.1),
+            basic::Cmplx(-0.2, 1.1), basic::Cmplx(0.6, -0.3),
+            basic::Cmplx(0.6, 0.3), basic::Cmplx(0.0, -3.0),
+            basic::Cmplx(0.0, 3.0)});
+
+    basic::CArry c = basic::to_coefficients(basic::Cmplx(1.7), expect);
+    basic::CArry result = basic::companion_roots(c);
+
+    ASSERT_EQ(expect.size(), result.size());
+
+    std::sort(std::begin(expect), std::end(expect), f);
+    std::sort(std::begin(result), std::end(result), f);
+
+    for(unsigned i=0; i<expect.size(); ++i)
+    {
+        ASSERT_NEAR(expect[i].real(), result[i].real(), 1e-10);
+        ASSERT_NEAR(expect[i].imag(), result[i].imag(), 1e-10);
+    }
+
+    // random coefficients: residuals are small relative to the scale of terms
+    basic::DArry d(41);
+    for(auto &it: d) it = drand(generator);
+
+    for(const auto &it: basic::companion_roots(d))
+    {
+        double scale = 0.0;
+        for(unsigned k=0; k<d.size(); ++k)
+            scale += std::abs(d[k]) * std::pow(std::abs(it), k);
+
+        ASSERT_LT(std::abs(basic::evaluate(basic::to_CArry(d), it)), 1e-12 * scale);
+    }
+
+    // a high degree, where the structured QR has to stay backward stable
+    basic::CArry z(201);
+    for(auto &it: z) it = basic::Cmplx(drand(generator), drand(generator));
+
+    result = basic::companion_roots(z);
+    ASSERT_EQ(200u, result.size());
+
+    for(const auto &it: result) ASSERT_LT(relative_residual(z, it), 1e-11);
+
+    // roots of unity, all of the same modulus
+    basic::CArry u(65, 0.0);
+    u[0] = -1.0; u[64] = 1.0;
+
+    for(const auto &it: basic::companion_roots(u))
+        ASSERT_NEAR(0.0, std::abs(std::pow(it, 64) - 1.0), 1e-12);
+}
+
+TEST(PolynomialRoots, CompanionRootsBadlyScaled)
+{
+    // Wilkinson's polynomial of degree 20; coefficients span 19 decades
+    basic::DArry w({1.0});
+    for(unsigned r=1; r<=20; ++r)
+    {
+        basic::DArry next(w.size()+1, 0.0);
+        for(unsigned i=0; i<w.size(); ++i) { next[i+1] += w[i]; next[i] -= r * w[i]; }
+        w = next;
+    }
+
+    basic::CArry result = basic::companion_roots(w);
+    std::sort(std::begin(result), std::end(result), f2);
+
+    ASSERT_EQ(20u, result.size());
+    for(unsigned i=0; i<20; ++i)
+    {
+        ASSERT_NEAR(i + 1.0, result[i].real(), 2e-3);
+        ASSERT_NEAR(0.0, result[i].imag(), 1e-8);
+    }
+
+    // x^10 + 1e-300, whose roots have modulus 1e-30
+    basic::CArry t(11, 0.0);
+    t[0] = 1e-300; t[10] = 1.0;
+
+    for(const auto &it: basic::companion_roots(t))
+    {
+        ASSERT_NEAR(1.0, std::abs(it) / 1e-30, 1e-12);
+        ASSERT_NEAR(0.0, std::abs(std::pow(it / 1e-30, 10) + 1.0), 1e-12);
+    }
+
+    // roots 1, 2, 4, ..., 2^15: a graded companion matrix
+    basic::CArry g;
+    for(unsigned k=0; k<16; ++k) g.push_back(std::ldexp(1.0, k));
+
+    result = basic::companion_roots(basic::to_coefficients(basic::Cmplx(1.0), g));
+    std::sort(std::begin(result), std::end(result), f2);
+
+    for(unsigned k=0; k<16; ++k)
+        ASSERT_NEAR(0.0, std::abs(result[k] - g[k]) / g[k].real(), 1e-12);
+}
+
+TEST(PolynomialRoots, MultiRealRootsYCCompanion)
+{
+    basic::DArry c({
+            0.0, -2.94912e-02, 8.84736e-02, 9.611264e-01, -3.1193088e+00,
+            -5.5872e+00, 2.51584e+01, -2.208e+00, -6.3264e+01, 5.2e+01, 3.6e+01,
+            -6.0e+01, 2.0e+01});
+
+    basic::DArry expect({
+            1., 1., 1., 0.8, 0.6, 0.4, 0.2, 0., -0.2, -0.4, -0.6, -0.8 });
+
+    basic::CArry result = basic::yan_and_chieng_2006(
+            c, 1e-10, basic::RootMethod::COMPANION);
+
+    std::sort(std::begin(expect), std::end(expect));
+    std::sort(std::begin(result), std::end(result), f2);
+
+    for(unsigned i=0; i<expect.size(); ++i)
+    {
+        ASSERT_NEAR(expect[i], result[i].real(), 1e-8);
+        ASSERT_NEAR(0.0, result[i].imag(), 1e-10);
+    }
+}
+
+TEST(PolynomialRoots, MultiRealRootsYCThreads)
+{
+    basic::DArry c({
+            0.0, -2.94912e-02, 8.84736e-02, 9.611264e-01, -3.1193088e+00,
+            -5.5872e+00, 2.51584e+01, -2.208e+00, -6.3264e+01, 5.2e+01, 3.6e+01,
+            -6.0e+01, 2.0e+01});
+
+    basic::DArry expect({
+            1., 1., 1., 0.8, 0.6, 0.4, 0.2, 0., -0.2, -0.4, -0.6, -0.8 });
+
+    // the refinement is Jacobi-style, so results do not depend on threads
+    basic::PhaseTimings timings;
+    basic::CArry result = basic::yan_and_chieng_2006(
+            c, timings, 1e-10, basic::RootMethod::ABERTH, 4);
+    basic::CArry serial = basic::yan_and_chieng_2006(c);
+
+    ASSERT_EQ(serial.size(), result.size());
+    for(unsigned i=0; i<result.size(); ++i) ASSERT_EQ(serial[i], result[i]);
+
+    ASSERT_GE(timings.gcd, 0.0);
+    ASSERT_GE(timings.refine, 0.0);
+    ASSERT_GT(timings.total(), 0.0);
+
+    std::sort(std::begin(expect), std::end(expect));
+    std::sort(std::begin(result), std::end(result), f2);
+
+    for(unsigned i=0; i<expect.size(); ++i)
+    {
+        ASSERT_NEAR(expect[i], result[i].real(), 1e-8);
+        ASSERT_NEAR(0.0, result[i].imag(), 1e-10);
+    }
+}
+
+TEST(PolynomialRoots, RootStatsScope)
+{
+    basic::DArry c({-0.3, 1.2, 0.7, -2.1, 0.4, 1.1, -0.9, 1.0});
+
+    basic::RootStats outer, inner;
+    {
+        basic::RootStatsScope s1(outer);
+        basic::newton_raphson(c, 0.5, 1e-12);
+        {
+            basic::RootStatsScope s2(inner);
+            basic::aberth(c, 1e-10);
+        }
+        basic::GCD(c, basic::derivative(c));
+    }
+
+    // without a scope nothing is recorded
+    basic::aberth(c, 1e-10);
+
+    if (! basic::root_stats_enabled())
+    {
+        ASSERT_EQ(0u, outer.iterations);
+        ASSERT_EQ(0u, inner.iterations);
+        return;
+    }
+
+    // the inner scope shadows the outer one
+    ASSERT_TRUE(outer.sweeps.empty());
+    ASSERT_EQ(c.size() - 1, inner.sweeps.size());
+    ASSERT_EQ(0u, inner.gcd_steps);
+    ASSERT_GT(outer.gcd_steps, 0u);
+
+    // Newton takes two evaluations per iteration
+    ASSERT_EQ(2 * outer.iterations, outer.evaluations);
+    ASSERT_GT(inner.evaluations, inner.iterations);
+    ASSERT_LT(outer.limit_ratio, 0.5);
+}
+
+TEST(PolynomialRoots, RealRootsInInterval)
+{
+    // roots on, inside, and outside the interval
+    basic::DArry c = basic::to_coefficients(1.3, basic::DArry({
+                -3.0, -1.0, -0.5, 0.1, 0.7, 1.0, 2.0}));
+
+    basic::DArry expect({-1.0, -0.5, 0.1, 0.7, 1.0});
+    basic::DArry result = basic::real_roots_in(c, -1.0, 1.0);
+
+    ASSERT_EQ(expect.size(), result.size());
+    for(unsigned i=0; i<expect.size(); ++i) ASSERT_NEAR(expect[i], result[i], 1e-12);
+
+    // a sub-interval
+    result = basic::real_roots_in(c, 0.0, 0.8);
+    ASSERT_EQ(2u, result.size());
+    ASSERT_NEAR(0.1, result[0], 1e-12);
+    ASSERT_NEAR(0.7, result[1], 1e-12);
+
+    // a double root is reported once
+    c = basic::to_coefficients(1.0, basic::DArry({-0.2, 0.3, 0.3}));
+    result = basic::real_roots_in(c, -1.0, 1.0);
+    ASSERT_EQ(2u, result.size());
+    ASSERT_NEAR(-0.2, result[0], 1e-12);
+    ASSERT_NEAR(0.3, result[1], 1e-7);
+
+    ASSERT_THROW(basic::real_roots_in(c, 1.0, -1.0), exceptions::PolynomialErrorGeneral);
+}
+
+TEST(PolynomialRoots, RealRootsInIntervalEndPoints)
+{
+    // roots on both ends and none inside: no spurious root in the middle
+    const std::vector<basic::DArry> cases({{-1.0, 0.0, 1.0}, {0.0, -1.0, 1.0},
+            {2.0, -3.0, 1.0}});
+    const double ends[][2] = {{-1.0, 1.0}, {0.0, 1.0}, {1.0, 2.0}};
+
+    for(unsigned i=0; i<cases.size(); ++i)
+    {
+        basic::DArry result = basic::real_roots_in(cases[i], ends[i][0], ends[i][1]);
+
+        ASSERT_EQ(2u, result.size());
+        ASSERT_DOUBLE_EQ(ends[i][0], result[0]);
+        ASSERT_DOUBLE_EQ(ends[i][1], result[1]);
+    }
+
+    // Wilkinson's polynomial of degree 20; coefficients span 19 decades
+    basic::DArry w({1.0});
+    for(unsigned r=1; r<=20; ++r)
+    {
+        basic::DArry next(w.size()+1, 0.0);
+        for(unsigned i=0; i<w.size(); ++i) { next[i+1] += w[i]; next[i] -= r * w[i]; }
+        w = next;
+    }
+
+    basic::DArry result = basic::real_roots_in(w, 0.0, 21.0);
+
+    ASSERT_EQ(20u, result.size());
+    for(unsigned i=0; i<20; ++i) ASSERT_NEAR(i + 1.0, result[i], 2e-3);
+}
+
+TEST(PolynomialRoots, RealRootsInIntervalRandom)
+{
+    for(unsigned trial=0; trial<10; ++trial)
+    {
+        basic::DArry c(25);
+        for(auto &it: c) it = drand(generator);
+
+        basic::DArry expect;
+        for(const auto &it: basic::yan_and_chieng_2006(c))
+            if ((std::abs(it.imag()) < 1e-10) && (std::abs(it.real()) <= 1.0))
+                expect.push_back(it.real());
+        std::sort(expect.begin(), expect.end());
+
+        basic::DArry result = basic::real_roots_in(c, -1.0, 1.0);
+
+        ASSERT_EQ(expect.size(), result.size());
+        for(unsigned i=0; i<expect.size(); ++i) ASSERT_NEAR(expect[i], result[i], 1e-10);
+    }
+}
+
+TEST(PolynomialRoots, LowDegreeFormula)
+{
+    std::vector<basic::CArry> cases({
+            {basic::Cmplx(0.3, 0.0), basic::Cmplx(-1.2, 0.5), basic::Cmplx(-1.2, -0.5)},
+            {basic::Cmplx(1e-3, 0.0), basic::Cmplx(2.0, 0.0), basic::Cmplx(-7e2, 0.0)},
+            {basic::Cmplx(0.1, 1.0), basic::Cmplx(-0.4, 0.2), basic::Cmplx(2.0, -3.0)},
+            {basic::Cmplx(0.2, 0.0), basic::Cmplx(-0.9, 0.0),
+                basic::Cmplx(0.5, 0.7), basic::Cmplx(0.5, -0.7)},
+            {basic::Cmplx(0.0, 1.0), basic::Cmplx(0.0, -1.0),
+                basic::Cmplx(2.0, 0.0), basic::Cmplx(-2.0, 0.0)}, // biquadratic
+            {basic::Cmplx(1.5, -0.5), basic::Cmplx(-0.3, 0.1),
+                basic::Cmplx(3.0, 2.0), basic::Cmplx(-1e-2, 0.0)}});
+
+    for(auto &expect: cases)
+    {
+        basic::CArry c = basic::to_coefficients(basic::Cmplx(-1.3), expect);
+
+        std::vector<unsigned> iters;
+        basic::CArry result = basic::aberth(c, basic::initial_guess(c), iters, 1e-12);
+
+        // closed forms need no iteration
+        for(const auto &it: iters) ASSERT_EQ(0u, it);
+
+        std::sort(std::begin(expect), std::end(expect), f);
+        std::sort(std::begin(result), std::end(result), f);
+
+        for(unsigned i=0; i<expect.size(); ++i)
+            ASSERT_NEAR(0.0, std::abs(expect[i] - result[i]),
+                    1e-12 * std::max(1.0, std::abs(expect[i])));
+    }
+}
+
+TEST(PolynomialRoots, BatchCubicQuartic)
+{
+    const unsigned N = 1000;
+
+    for(unsigned deg=3; deg<5; ++deg)
+    {
+        basic::DArry c((deg+1)*N), re(deg*N), im(deg*N);
+        for(auto &it: c) it = drand(generator);
+
+        if (deg == 3) basic::cubic_roots(N, c.data(), re.data(), im.data());
+        else basic::quartic_roots(N, c.data(), re.data(), im.data());
+
+        for(unsigned i=0; i<N; ++i)
+        {
+            basic::CArry ci(deg+1), expect, result(deg);
+            for(unsigned k=0; k<=deg; ++k) ci[k] = c[k*N+i];
+            for(unsigned j=0; j<deg; ++j) result[j] = basic::Cmplx(re[j*N+i], im[j*N+i]);
+
+            // compare with the scalar closed forms; nearly multiple roots are
+            // ill-conditioned, so match each root to the closest one
+            expect = basic::aberth(ci, 1e-12);
+
+            for(unsigned j=0; j<deg; ++j)
+            {
+                double dist = 1e300;
+                for(const auto &it: expect)
+                    dist = std::min(dist, std::abs(it - result[j]) / std::max(1.0, std::abs(it)));
+                ASSERT_LT(dist, 1e-6);
+            }
+        }
+    }
+}
+
+TEST(PolynomialRoots, BatchRoots)
+{
+    const unsigned N = 300, deg = 9, len = deg + 1, stride = len + 3;
+
+    // polynomials from known real roots and complex-conjugate pairs
+    basic::DArry c(N * stride, 0.0);
+    std::vector<basic::CArry> expect(N);
+    for(unsigned i=0; i<N; ++i)
+    {
+        for(unsigned j=0; j<3; ++j) expect[i].push_back(drand(generator));
+        for(unsigned j=0; j<3; ++j)
+        {
+            basic::Cmplx z(drand(generator), 0.5 + std::abs(drand(generator)));
+            expect[i].push_back(z);
+            expect[i].push_back(std::conj(z));
+        }
+
+        basic::CArry ci = basic::to_coefficients(basic::Cmplx(1.0), expect[i]);
+        for(unsigned k=0; k<len; ++k) c[i*stride+k] = ci[k].real();
+    }
+
+    // a zero leading coefficient and a NaN
+    c[7*stride+deg] = 0.0;
+    c[11*stride+2] = std::nan("");
+
+    basic::DArry re1(N*deg), im1(N*deg), re4(N*deg), im4(N*deg);
+    std::vector<int> s1(N), s4(N);
+
+    basic::batch_roots(N, len, c.data(), stride, re1.data(), im1.data(), s1.data(), 1e-12);
+    basic::batch_roots(N, len, c.data(), stride, re4.data(), im4.data(), s4.data(), 1e-12, 4);
+
+    for(unsigned i=0; i<N; ++i)
+    {
+        // threads only split the work; results are identical
+        ASSERT_EQ(s1[i], s4[i]);
+        for(unsigned j=0; j<deg; ++j)
+        {
+            if (std::isnan(re1[i*deg+j])) { ASSERT_TRUE(std::isnan(re4[i*deg+j])); continue; }
+            ASSERT_EQ(re1[i*deg+j], re4[i*deg+j]);
+            ASSERT_EQ(im1[i*deg+j], im4[i*deg+j]);
+        }
+
+        if ((i == 7) || (i == 11))
+        {
+            ASSERT_EQ(basic::RootStatus::BAD_COEFFS, s1[i]);
+            ASSERT_TRUE(std::isnan(re1[i*deg]));
+            continue;
+        }
+
+        ASSERT_EQ(basic::RootStatus::CONVERGED, s1[i]);
+
+        basic::CArry result(deg);
+        for(unsigned j=0; j<deg; ++j) result[j] = basic::Cmplx(re1[i*deg+j], im1[i*deg+j]);
+
+        for(const auto &z: expect[i])
+        {
+            double dist = 1e300;
+            for(const auto &it: result) dist = std::min(dist, std::abs(it - z));
+            ASSERT_LT(dist, 1e-8);
+        }
+    }
+
+    // Gaussian real coefficients of high degree; the moduli of p(z) and p'(z)
+    // overflow when squared, which must not turn roots into NaN
+    const unsigned M = 40, hdeg = 300;
+    std::normal_distribution<double> gauss;
+    basic::DArry h(M * (hdeg + 1)), hr(M * hdeg), hi(M * hdeg);
+    for(auto &it: h) it = gauss(generator);
+
+    std::vector<int> hs(M);
+    basic::batch_roots(M, hdeg + 1, h.data(), hdeg + 1, hr.data(), hi.data(), hs.data());
+
+    for(unsigned i=0; i<M; ++i) ASSERT_EQ(basic::RootStatus::CONVERGED, hs[i]);
+    for(unsigned j=0; j<M*hdeg; ++j)
+        ASSERT_TRUE(std::isfinite(hr[j]) && std::isfinite(hi[j]));
+
+    // low degrees go through the closed forms
+    basic::DArry q({-6.0, 11.0, -6.0, 1.0}), qr(3), qi(3);
+    int qs;
+    basic::batch_roots(1, 4, q.data(), 4, qr.data(), qi.data(), &qs);
+    ASSERT_EQ(basic::RootStatus::CONVERGED, qs);
+    std::sort(qr.begin(), qr.end());
+    for(unsigned j=0; j<3; ++j) ASSERT_NEAR(j + 1.0, qr[j], 1e-12);
+}
+
+TEST(PolynomialRoots, Compensated)
+{
+    // Wilkinson's polynomial of degree 14; all coefficients are exact in double
+    basic::DArry c({1.0});
+    for(unsigned r=1; r<=14; ++r)
+    {
+        basic::DArry next(c.size()+1, 0.0);
+        for(unsigned i=0; i<c.size(); ++i) { next[i+1] += c[i]; next[i] -= r * c[i]; }
+        c = next;
+    }
+
+    for(unsigned r=4; r<=14; ++r)
+        ASSERT_NEAR(double(r), basic::newton_raphson(c, r+0.3, 1e-13,
+                    basic::Accuracy::COMPENSATED), 4e-15 * r);
+
+    basic::CArry roots = basic::yan_and_chieng_2006(c, 1e-10);
+    basic::polish(c, roots);
+
+    for(const auto &z: roots)
+        ASSERT_NEAR(0.0, std::abs(z - std::round(z.real())), 4e-15 * std::abs(z));
+}
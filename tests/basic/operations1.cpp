@@ -250,3 +250,61 @@ TEST(PolynomialGCD, GCD3)
         ASSERT_NEAR(q3_expect[i], q3[i], 1e-8);
 
 }
+
+TEST(PolynomialGCD, GCD4)
+{
+    // (x - 0.5)^2 (x + 1) and (x - 0.5) (x - 2) share x - 0.5
+    basic::DArry p1 = basic::to_coefficients(1.0, basic::DArry({0.5, 0.5, -1.0}));
+    basic::DArry p2 = basic::to_coefficients(3.0, basic::DArry({0.5, 2.0}));
+
+    // the lower-degree polynomial may come first
+    basic::DArry q1 = basic::GCD(p1, p2), q2 = basic::GCD(p2, p1);
+    ASSERT_EQ(2u, q1.size());
+    ASSERT_EQ(2u, q2.size());
+    for(unsigned i=0; i<2; ++i)
+    {
+        ASSERT_NEAR(i ? 1.0 : -0.5, q1[i], 1e-12);
+        ASSERT_NEAR(i ? 1.0 : -0.5, q2[i], 1e-12);
+    }
+
+    // complex coefficients: (x - i)^3 (x + 1)
+    basic::CArry c = basic::to_coefficients(basic::Cmplx(1.0),
+            basic::CArry({basic::Cmplx(0., 1.), basic::Cmplx(0., 1.),
+                basic::Cmplx(0., 1.), basic::Cmplx(-1.)}));
+    basic::CArry expect({basic::Cmplx(-1.), basic::Cmplx(0., -2.), basic::Cmplx(1.)});
+
+    basic::CArry q3 = basic::GCD(c, basic::derivative(c));
+    ASSERT_EQ(expect.size(), q3.size());
+    for(unsigned i=0; i<expect.size(); ++i) ASSERT_NEAR(0.0, std::abs(expect[i] - q3[i]), 1e-8);
+
+    // a constant divisor
+    ASSERT_EQ(basic::DArry({1.0}), basic::GCD(p1, basic::DArry({4.0})));
+}
+
+TEST(PolynomialGCD, HalfGCD)
+{
+    // divisors of degree above 2048 go through the half GCD; the cofactors
+    // come from raw mt19937 draws, which are the same on every platform
+    std::mt19937 gen(2);
+    auto draw = [&gen]()->double { return gen() / 2147483648.0 - 1.0; };
+
+    const unsigned n = 2200;
+
+    basic::DArry f({-0.5, 0.2, 1.0}), g(n+1), h(n);
+    for(auto &it: g) it = draw();
+    for(auto &it: h) it = draw();
+
+    basic::DArry q = basic::GCD(basic::multiply(f, g), basic::multiply(f, h));
+    ASSERT_EQ(f.size(), q.size());
+    for(unsigned i=0; i<f.size(); ++i) ASSERT_NEAR(f[i], q[i], 1e-8);
+
+    // complex coefficients
+    basic::CArry fc({basic::Cmplx(-0.5, 0.3), basic::Cmplx(0.2, -0.1), basic::Cmplx(1.0)}),
+                 gc(n+1), hc(n);
+    for(auto &it: gc) it = basic::Cmplx(draw(), draw());
+    for(auto &it: hc) it = basic::Cmplx(draw(), draw());
+
+    basic::CArry qc = basic::GCD(basic::multiply(fc, gc), basic::multiply(fc, hc));
+    ASSERT_EQ(fc.size(), qc.size());
+    for(unsigned i=0; i<fc.size(); ++i) ASSERT_NEAR(0.0, std::abs(fc[i] - qc[i]), 1e-8);
+}
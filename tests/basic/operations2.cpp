@@ -229,3 +229,72 @@ TEST(PolynomialDivide, RandomPolynomial)
 
     for(unsigned i=0; i<len1; ++i) ASSERT_NEAR(p1[i], expect[i], 1e-8);
 }
+
+TEST(PolynomialDivide, SyntheticDivision)
+{
+    basic::DArry p1({-3.0, 2.5, 0.0, -1.5, 2.0, 1.0});
+
+    // linear factor: compare with general division
+    basic::DArry q = p1, r, expect = basic::divide(p1, basic::DArry({-0.7, 1.0}), r);
+    double rem = basic::synthetic_division(q, 0.7);
+
+    ASSERT_EQ(expect.size(), q.size());
+    for(unsigned i=0; i<q.size(); ++i) ASSERT_NEAR(expect[i], q[i], 1e-14);
+    ASSERT_NEAR(r[0], rem, 1e-14);
+    ASSERT_NEAR(basic::evaluate(p1, 0.7), rem, 1e-14);
+
+    // quadratic factor
+    double r1, r0;
+    q = p1;
+    expect = basic::divide(p1, basic::DArry({0.8, -0.3, 1.0}), r);
+    basic::synthetic_division(q, -0.3, 0.8, r1, r0);
+
+    ASSERT_EQ(expect.size(), q.size());
+    for(unsigned i=0; i<q.size(); ++i) ASSERT_NEAR(expect[i], q[i], 1e-14);
+    ASSERT_NEAR(r[0], r0, 1e-14);
+    ASSERT_NEAR(r[1], r1, 1e-14);
+
+    // degrees lower than the factor give zero quotients
+    basic::DArry c({2.0});
+    ASSERT_EQ(2.0, basic::synthetic_division(c, 0.5));
+    ASSERT_EQ(basic::DArry({0.0}), c);
+
+    c = {2.0, 3.0};
+    basic::synthetic_division(c, 1.0, 1.0, r1, r0);
+    ASSERT_EQ(basic::DArry({0.0}), c);
+    ASSERT_EQ(3.0, r1);
+    ASSERT_EQ(2.0, r0);
+}
+
+TEST(PolynomialDivide, Deflate)
+{
+    basic::DArry roots({-1.0, 0.25, 0.5, 0.5, 3.0});
+    basic::CArry pairs({basic::Cmplx(0.2, 0.9), basic::Cmplx(0.2, -0.9)});
+
+    // real and complex roots together
+    basic::DArry p = basic::multiply(
+            basic::to_coefficients(2.0, roots),
+            basic::to_DArry(basic::to_coefficients(basic::Cmplx(1.0), pairs)));
+
+    basic::DArry q = p;
+    basic::deflate(q, basic::DArry({3.0, 0.5, -1.0}), pairs);
+
+    basic::DArry expect = basic::to_coefficients(2.0, basic::DArry({0.25, 0.5}));
+    ASSERT_EQ(expect.size(), q.size());
+    for(unsigned i=0; i<q.size(); ++i) ASSERT_NEAR(expect[i], q[i], 1e-12);
+
+    // complex arithmetic
+    basic::CArry cq = basic::to_CArry(p);
+    basic::deflate(cq, basic::CArry({pairs[0], basic::Cmplx(0.25), pairs[1]}));
+    expect = basic::to_coefficients(2.0, basic::DArry({-1.0, 0.5, 0.5, 3.0}));
+    ASSERT_EQ(expect.size(), cq.size());
+    for(unsigned i=0; i<cq.size(); ++i) ASSERT_NEAR(0.0, std::abs(expect[i] - cq[i]), 1e-12);
+
+    // unpaired complex roots and too many roots
+    q = p;
+    ASSERT_THROW(basic::deflate(q, basic::DArry(), basic::CArry({pairs[0]})),
+            exceptions::PolynomialErrorGeneral);
+    q = {1.0, 1.0};
+    ASSERT_THROW(basic::deflate(q, basic::DArry({-1.0, 2.0})),
+            exceptions::PolynomialErrorGeneral);
+}
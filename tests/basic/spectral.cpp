@@ -0,0 +1,132 @@
+/**
+ * \file spectral.cpp
+ * \brief Unit tests for pseudospectral matrix builders.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+
+# include <cmath>
+
+# include <gtest/gtest.h>
+
+# include "exceptions.h"
+# include "quadrature.h"
+# include "spectral.h"
+
+using namespace simpoly;
+
+// coefficients of a testing polynomial of degree n-1
+static basic::DArry testing_coeffs(const unsigned n)
+{
+    basic::DArry c(n);
+    for(unsigned i=0; i<n; ++i) c[i] = std::cos(1.0 + i);
+    return c;
+}
+
+static basic::DArry rule_nodes(const poly::PolyType type, const unsigned n)
+{
+    poly::RulePtr rule = poly::quadrature_rule(type, n);
+    return basic::DArry(rule->nodes(), rule->nodes()+n);
+}
+
+TEST(SpectralMatrices, BarycentricWeights)
+{
+    basic::DArry x({-1.0, 0.0, 0.5, 1.0});
+    basic::DArry w = spectral::barycentric_weights(x);
+
+    // unscaled weights; the two sets differ only by a common factor
+    basic::DArry expect(x.size(), 1.0);
+    for(unsigned j=0; j<x.size(); ++j)
+        for(unsigned k=0; k<x.size(); ++k)
+            if (k != j) expect[j] /= (x[j] - x[k]);
+
+    for(unsigned j=1; j<x.size(); ++j)
+        ASSERT_NEAR(expect[j] / expect[0], w[j] / w[0], 1e-12);
+
+    // coincident nodes
+    ASSERT_THROW(spectral::barycentric_weights({0.0, 1.0, 1.0}),
+            exceptions::PolynomialErrorGeneral);
+    ASSERT_THROW(spectral::barycentric_weights({0.5, 0.5}),
+            exceptions::PolynomialErrorGeneral);
+    ASSERT_THROW(spectral::differentiation_matrix({1.0, 1.0, 1.0}),
+            exceptions::PolynomialErrorGeneral);
+}
+
+TEST(SpectralMatrices, Differentiation)
+{
+    for(unsigned n=2; n<20; ++n)
+    {
+        basic::DArry x = rule_nodes(poly::PolyType::LEFTRADAU, n);
+        basic::DArry c = testing_coeffs(n), dc = basic::derivative(c);
+        basic::DArry D = spectral::differentiation_matrix(x);
+
+        for(unsigned i=0; i<n; ++i)
+        {
+            double value = 0.0;
+            for(unsigned j=0; j<n; ++j) value += D[i*n+j] * basic::evaluate(c, x[j]);
+            ASSERT_NEAR(basic::evaluate(dc, x[i]), value, 1e-9);
+        }
+    }
+}
+
+TEST(SpectralMatrices, Interpolation)
+{
+    const unsigned n = 9, m = 23;
+    basic::DArry x = rule_nodes(poly::PolyType::LEGENDRE, n);
+    basic::DArry y(m);
+    for(unsigned k=0; k<m; ++k) y[k] = -1.0 + 2.0 * k / (m - 1.0);
+    y[3] = x[4]; // coincide with a node
+
+    basic::DArry c = testing_coeffs(n);
+    basic::DArry M = spectral::interpolation_matrix(x, y);
+
+    for(unsigned k=0; k<m; ++k)
+    {
+        double value = 0.0;
+        for(unsigned j=0; j<n; ++j) value += M[k*n+j] * basic::evaluate(c, x[j]);
+        ASSERT_NEAR(basic::evaluate(c, y[k]), value, 1e-12);
+    }
+
+    for(unsigned j=0; j<n; ++j) ASSERT_EQ((j==4)?1.0:0.0, M[3*n+j]);
+}
+
+TEST(SpectralMatrices, Integration)
+{
+    for(unsigned n=1; n<16; ++n)
+    {
+        basic::DArry x = rule_nodes(poly::PolyType::RIGHTRADAU, n);
+        basic::DArry c = testing_coeffs(n), ic = basic::integral(c);
+        basic::DArry S = spectral::integration_matrix(x);
+
+        for(unsigned i=0; i<n; ++i)
+        {
+            double value = 0.0;
+            for(unsigned j=0; j<n; ++j) value += S[i*n+j] * basic::evaluate(c, x[j]);
+            ASSERT_NEAR(basic::evaluate(ic, x[i]) - basic::evaluate(ic, -1.0),
+                    value, 1e-12);
+        }
+    }
+}
+
+TEST(SpectralMatrices, MultiThreaded)
+{
+    const unsigned n = 31;
+    basic::DArry x = rule_nodes(poly::PolyType::LEGENDRE, n);
+
+    basic::DArry D1 = spectral::differentiation_matrix(x);
+    basic::DArry D2 = spectral::differentiation_matrix(x, 4);
+    basic::DArry S1 = spectral::integration_matrix(x, 0.0);
+    basic::DArry S2 = spectral::integration_matrix(x, 0.0, 3);
+    basic::DArry M1 = spectral::interpolation_matrix(x, x);
+    basic::DArry M2 = spectral::interpolation_matrix(x, x, 5);
+
+    for(unsigned i=0; i<n*n; ++i)
+    {
+        ASSERT_EQ(D1[i], D2[i]);
+        ASSERT_EQ(S1[i], S2[i]);
+        ASSERT_EQ(M1[i], M2[i]);
+        ASSERT_EQ((i%(n+1)==0)?1.0:0.0, M1[i]);
+    }
+}
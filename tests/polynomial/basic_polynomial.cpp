@@ -0,0 +1,116 @@
+/**
+ * \file tests/polynomial/basic_polynomial.cpp
+ * \brief Unit tests for polynomials with generic scalar types.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# include <algorithm>
+# include <cmath>
+# include <complex>
+# include <limits>
+
+# include <gtest/gtest.h>
+
+# include "basic_polynomial.h"
+
+using namespace simpoly;
+
+static const basic::DArry c({0.3, -1.2, 0.5, 2.0, -0.7, 1.1});
+
+TEST(BasicPolynomial, Float)
+{
+    poly::Polynomial p(c);
+    poly::PolynomialF pf(p);
+
+    ASSERT_EQ(5u, pf.degree());
+
+    basic::FArry x({-1.0f, -0.3f, 0.0f, 0.4f, 0.9f, 1.5f});
+    basic::FArry y = pf(x);
+
+    for(unsigned i=0; i<x.size(); ++i)
+    {
+        ASSERT_NEAR(p(x[i]), y[i], 1e-5);
+        ASSERT_EQ(pf(x[i]), y[i]);
+    }
+
+    // calculus and arithmetic follow the double version
+    poly::PolynomialF d = pf.deriv(), s = pf * pf - 2.0f * pf, i = pf.integ();
+    for(const auto &it: x)
+    {
+        ASSERT_NEAR(p.deriv()(it), d(it), 1e-4);
+        ASSERT_NEAR(p(it) * p(it) - 2.0 * p(it), s(it), 1e-3);
+        ASSERT_NEAR(p.integ()(it), i(it), 1e-5);
+    }
+
+    // roots come from the double-precision engine, rounded to float
+    basic::Arry<std::complex<float>> rts = pf.roots();
+    ASSERT_EQ(5u, rts.size());
+    for(const auto &it: rts)
+        ASSERT_NEAR(0.0, std::abs(basic::evaluate(basic::to_CArry(c), basic::Cmplx(it))), 1e-6);
+}
+
+TEST(BasicPolynomial, LongDouble)
+{
+    // (x - 1)^8 in monomial form is badly conditioned near x = 1
+    basic::LArry c8({1.0L});
+    for(unsigned k=0; k<8; ++k)
+        c8 = basic::multiply(c8, basic::LArry({-1.0L, 1.0L}));
+
+    poly::PolynomialL pl(c8);
+    poly::BasicPolynomial<double> pd(pl);
+
+    const long double x = 1.01L, exact = std::pow(0.01L, 8);
+    const long double el = std::abs(pl(x) - exact), ed = std::abs(pd(x) - exact);
+
+    ASSERT_LT(el, 1e-14L);
+    if (std::numeric_limits<long double>::epsilon() < std::numeric_limits<double>::epsilon())
+    {
+        ASSERT_LT(el, ed);
+    }
+
+    // division with remainder
+    poly::PolynomialL R, Q = pl.divide(poly::PolynomialL({-1.0L, 1.0L}), R);
+    ASSERT_EQ(7u, Q.degree());
+    ASSERT_EQ(0u, R.degree());
+    ASSERT_NEAR(0.0, (double) R.coef()[0], 1e-15);
+
+    Q /= 2.0L;
+    Q *= 2.0L;
+    Q -= pl.divide(poly::PolynomialL({-1.0L, 1.0L}), R);
+    ASSERT_EQ(0u, Q.degree());
+}
+
+TEST(BasicPolynomial, LongDoubleRoots)
+{
+    // (x - 1) (x - 2) ... (x - 12); its coefficients are exact in long double
+    basic::LArry c12({1.0L});
+    for(unsigned k=1; k<=12; ++k)
+        c12 = basic::multiply(c12, basic::LArry({-(long double) k, 1.0L}));
+
+    poly::PolynomialL pl(c12);
+    basic::Arry<std::complex<long double>> rl = pl.roots();
+    basic::CArry rd = pl.to_polynomial().roots();
+    ASSERT_EQ(12u, rl.size());
+
+    // distance to the nearest exact root
+    long double el = 0, ed = 0;
+    for(unsigned i=0; i<12; ++i)
+    {
+        long double ml = 1, md = 1;
+        for(unsigned k=1; k<=12; ++k)
+        {
+            ml = std::min(ml, std::abs(rl[i] - (long double) k));
+            md = std::min(md, (long double) std::abs(rd[i] - (double) k));
+        }
+        el = std::max(el, ml);
+        ed = std::max(ed, md);
+    }
+
+    ASSERT_LT(el, 1e-7L);
+    if (std::numeric_limits<long double>::epsilon() < std::numeric_limits<double>::epsilon())
+    {
+        ASSERT_LT(100 * el, ed);
+    }
+}
@@ -6,6 +6,8 @@
  * \date 2018-02-08
  */
 
+# include <cmath>
+
 # include <gtest/gtest.h>
 
 # include "polynomial.h"
@@ -54,3 +56,41 @@ TEST(PolynomialCalculus, Integral)
     for(unsigned i=0; i<expect.size(); i++)
         ASSERT_NEAR(expect[i], result[i], 1e-10);
 }
+
+TEST(PolynomialCalculus, Shift)
+{
+    poly::Polynomial p({1.0, -2.0, 0.5, 3.0, -1.0, 0.25}),
+                     q = p.shift(0.3), r = p.compose_affine(0.5, -0.2);
+
+    for(double x=-1.0; x<=1.0; x+=0.25)
+    {
+        ASSERT_NEAR(p(x + 0.3), q(x), 1e-12);
+        ASSERT_NEAR(p(0.5 * x - 0.2), r(x), 1e-12);
+    }
+
+    // high degrees go through the fast shift
+    basic::DArry c(301);
+    for(unsigned i=0; i<c.size(); ++i) c[i] = std::cos(1.0 + i);
+
+    const basic::DArry expect = basic::compose_affine(c, 2.0, -0.2),
+                       result = poly::Polynomial(c).compose_affine(2.0, -0.2).coef();
+
+    ASSERT_EQ(expect.size(), result.size());
+
+    double scale = 0.0;
+    for(const auto &it: expect) scale = std::max(scale, std::abs(it));
+
+    for(unsigned i=0; i<expect.size(); ++i)
+        ASSERT_NEAR(expect[i], result[i], 1e-13 * scale);
+}
+
+TEST(PolynomialCalculus, Compose)
+{
+    poly::Polynomial p({1.0, -2.0, 0.5, 3.0, -1.0, 0.25}), q({0.5, -1.0, 0.0, 2.0}),
+                     r = poly::compose(p, q);
+
+    ASSERT_EQ(15u, r.degree());
+
+    for(double x=-1.0; x<=1.0; x+=0.25)
+        ASSERT_NEAR(p(q(x)), r(x), 1e-11);
+}
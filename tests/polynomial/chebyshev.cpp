@@ -0,0 +1,117 @@
+/**
+ * \file tests/polynomial/chebyshev.cpp
+ * \brief Unit tests for Chebyshev series.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# include <cmath>
+
+# include <gtest/gtest.h>
+
+# include "chebyshev.h"
+
+using namespace simpoly;
+
+static const basic::DArry x({-1.0, -0.83, -0.4, 0.0, 0.15, 0.6, 0.97, 1.0});
+
+static double f(const double x) { return std::exp(x) * std::sin(3.0 * x); }
+
+
+TEST(Chebyshev, Interpolation)
+{
+    // DCT lengths 2n of powers of two and of other numbers
+    for(const unsigned n: {1u, 2u, 16u, 17u, 30u, 45u})
+    {
+        poly::Chebyshev p = poly::Chebyshev::interpolate(f, n);
+        ASSERT_EQ(n, p.degree());
+
+        // interpolation conditions
+        const basic::DArry pts = poly::Chebyshev::points(n), v = p.values();
+        for(unsigned j=0; j<=n; ++j)
+        {
+            ASSERT_NEAR(f(pts[j]), v[j], 1e-13);
+            ASSERT_NEAR(f(pts[j]), p(pts[j]), 1e-13);
+        }
+    }
+
+    // spectral convergence
+    poly::Chebyshev p = poly::Chebyshev::interpolate(f, 30);
+    const basic::DArry y = p(x);
+    for(unsigned i=0; i<x.size(); ++i)
+    {
+        ASSERT_NEAR(f(x[i]), y[i], 1e-14);
+        ASSERT_EQ(p(x[i]), y[i]);
+    }
+}
+
+
+TEST(Chebyshev, Transforms)
+{
+    // coefficients -> values -> coefficients at a high degree
+    basic::DArry c(1001);
+    for(unsigned k=0; k<c.size(); ++k) c[k] = std::cos(0.37 * k) / (1.0 + k);
+
+    poly::Chebyshev p(c), q = poly::Chebyshev::interpolate(p.values());
+    for(unsigned k=0; k<c.size(); ++k) ASSERT_NEAR(c[k], q.coef()[k], 1e-14);
+
+    const basic::DArry pts = poly::Chebyshev::points(3);
+    ASSERT_EQ(4u, pts.size());
+    ASSERT_EQ(1.0, pts[0]);
+    ASSERT_NEAR(0.5, pts[1], 1e-16);
+    ASSERT_EQ(-pts[1], pts[2]);
+    ASSERT_EQ(-1.0, pts[3]);
+}
+
+
+TEST(Chebyshev, Calculus)
+{
+    poly::Chebyshev p = poly::Chebyshev::interpolate(f, 40),
+                    d = p.deriv(), s = p.integ();
+
+    ASSERT_EQ(39u, d.degree());
+    ASSERT_EQ(41u, s.degree());
+
+    auto df = [](const double x) { return std::exp(x) * (std::sin(3.0 * x) + 3.0 * std::cos(3.0 * x)); };
+    auto sf = [](const double x) {
+        return std::exp(x) * (std::sin(3.0 * x) - 3.0 * std::cos(3.0 * x)) / 10.0; };
+
+    for(const auto &it: x)
+    {
+        ASSERT_NEAR(df(it), d(it), 1e-12);
+        ASSERT_NEAR(sf(it) - sf(-1.0), s(it), 1e-14);
+    }
+
+    ASSERT_EQ(0.0, poly::Chebyshev(basic::DArry(1, 3.0)).deriv()(0.5));
+    ASSERT_NEAR(3.0 * 1.5, poly::Chebyshev(basic::DArry(1, 3.0)).integ()(0.5), 1e-15);
+}
+
+
+TEST(Chebyshev, Conversions)
+{
+    // T_3 = 4x^3 - 3x
+    ASSERT_EQ(poly::Polynomial({0.0, -3.0, 0.0, 4.0}),
+            poly::Chebyshev(basic::DArry({0.0, 0.0, 0.0, 1.0})).to_polynomial());
+
+    const poly::Polynomial m({0.3, -1.2, 0.5, 2.0, -0.7, 1.1});
+    poly::Chebyshev p(m);
+    ASSERT_EQ(m, p.to_polynomial());
+    for(const auto &it: x) ASSERT_NEAR(m(it), p(it), 1e-14);
+}
+
+
+TEST(Chebyshev, Arithmetic)
+{
+    poly::Chebyshev p(basic::DArry({0.3, -1.2, 0.5, 2.0})), q(basic::DArry({-0.4, 0.9, 1.5}));
+
+    poly::Chebyshev s = p + q, t = p - 2.0 * q, u = p * q;
+    ASSERT_EQ(5u, u.degree());
+
+    for(const auto &it: x)
+    {
+        ASSERT_NEAR(p(it) + q(it), s(it), 1e-14);
+        ASSERT_NEAR(p(it) - 2.0 * q(it), t(it), 1e-14);
+        ASSERT_NEAR(p(it) * q(it), u(it), 1e-13);
+    }
+}
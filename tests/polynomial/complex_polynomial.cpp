@@ -0,0 +1,118 @@
+/**
+ * \file tests/polynomial/complex_polynomial.cpp
+ * \brief Unit tests for polynomials with complex coefficients.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# include <algorithm>
+# include <cmath>
+
+# include <gtest/gtest.h>
+
+# include "complex_polynomial.h"
+
+# include "helpers.h"
+
+using namespace simpoly;
+
+using C = basic::Cmplx;
+
+// roots without conjugate pairs; 0.3 - 0.4i is a double root
+static const basic::CArry rts({C(1.0, 2.0), C(0.0, -0.5), C(0.3, -0.4), C(0.3, -0.4), C(-1.5, 0.2)});
+static const C lead(2.0, -1.0);
+
+
+TEST(ComplexPolynomial, Roots)
+{
+    poly::ComplexPolynomial p(basic::to_coefficients(lead, rts));
+
+    ASSERT_EQ(5u, p.degree());
+    ASSERT_FALSE(p.use_roots());
+    expect_roots(rts, p.roots(), 1e-10);
+
+    // the cache is handed out by reference
+    ASSERT_EQ(&p.roots(), &p.roots());
+
+    p.set(basic::RootMethod::COMPANION);
+    ASSERT_EQ(basic::RootMethod::COMPANION, p.root_method());
+    expect_roots(rts, p.roots(), 1e-10);
+
+    p.set(basic::Accuracy::COMPENSATED);
+    expect_roots(rts, p.roots(), 1e-10);
+
+    // roots from a Polynomial with real coefficients
+    poly::ComplexPolynomial q(poly::Polynomial(basic::DArry({-5., 4., 4., -4., 1.})));
+    expect_roots({1.0, -1.0, C(2.0, -1.0), C(2.0, 1.0)}, q.roots(), 1e-10);
+}
+
+
+TEST(ComplexPolynomial, Evaluation)
+{
+    const basic::CArry c = basic::to_coefficients(lead, rts);
+    poly::ComplexPolynomial p(c), r(lead, rts);
+
+    ASSERT_TRUE(r.use_roots());
+
+    const basic::CArry x({C(0.1, 0.2), C(-1.0, 0.5), C(2.0, -0.3), C(0.0, 1.0)});
+    const basic::CArry y = p(x), yr = r(x);
+
+    for(unsigned i=0; i<x.size(); ++i)
+    {
+        const C expect = basic::evaluate(c, x[i]);
+        ASSERT_NEAR(0.0, std::abs(expect - y[i]), 1e-12 * std::abs(expect));
+        ASSERT_NEAR(0.0, std::abs(expect - yr[i]), 1e-12 * std::abs(expect));
+        ASSERT_EQ(p(x[i]), y[i]);
+    }
+}
+
+
+TEST(ComplexPolynomial, Operators)
+{
+    poly::ComplexPolynomial p({C(1.0, 1.0), C(0.0, 2.0), C(3.0, 0.0)}),
+                            q({C(0.5, 0.0), C(-1.0, 1.0)});
+
+    ASSERT_EQ(poly::ComplexPolynomial({C(1.5, 1.0), C(-1.0, 3.0), C(3.0, 0.0)}), p + q);
+    ASSERT_EQ(poly::ComplexPolynomial({C(0.5, 1.0), C(1.0, 1.0), C(3.0, 0.0)}), p - q);
+    ASSERT_EQ(poly::ComplexPolynomial({C(1.0, 2.0), C(0.0, 2.0), C(3.0, 0.0)}), p + C(0.0, 1.0));
+    ASSERT_EQ(poly::ComplexPolynomial({C(-2.0, 2.0), C(-4.0, 0.0), C(0.0, 6.0)}), C(0.0, 2.0) * p);
+    ASSERT_EQ(p, (p * C(0.0, 2.0)) / C(0.0, 2.0));
+    ASSERT_EQ(poly::ComplexPolynomial({C(0.0, 2.0), C(6.0, 0.0)}), p.deriv());
+    ASSERT_EQ(p, p.integ().deriv());
+
+    poly::ComplexPolynomial R, Q = (p * q + C(0.3, -0.2)).divide(q, R);
+    ASSERT_EQ(p, Q);
+    ASSERT_EQ(poly::ComplexPolynomial({C(0.3, -0.2)}), R);
+    ASSERT_EQ(R, (p * q + C(0.3, -0.2)) % q);
+    ASSERT_NE(p, q);
+}
+
+
+TEST(ComplexPolynomial, CachedRoots)
+{
+    poly::ComplexPolynomial p(lead, {rts[0], rts[1]}), q(C(1.0), {rts[4]});
+
+    // products of polynomials with known roots keep them
+    poly::ComplexPolynomial pq = p * q;
+    ASSERT_TRUE(pq.use_roots());
+    expect_roots({rts[0], rts[1], rts[4]}, pq.roots(), 0.0);
+
+    // deflation updates the cache
+    pq.deflate({rts[1]});
+    ASSERT_EQ(2u, pq.degree());
+    expect_roots({rts[0], rts[4]}, pq.roots(), 0.0);
+    ASSERT_NEAR(0.0, std::abs(pq(rts[0])), 1e-12);
+
+    // deflation by a root not in the cache drops it
+    poly::ComplexPolynomial s(basic::to_coefficients(lead, rts));
+    s.roots();
+    s.deflate({C(7.0, 7.0)});
+    ASSERT_EQ(4u, s.degree());
+    ASSERT_FALSE(s.use_roots());
+
+    // modifications drop cached roots
+    pq += C(1.0, 0.0);
+    ASSERT_FALSE(pq.use_roots());
+    ASSERT_NEAR(0.0, std::abs(pq(pq.roots()[0])), 1e-12);
+}
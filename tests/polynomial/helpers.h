@@ -0,0 +1,31 @@
+/**
+ * \file tests/polynomial/helpers.h
+ * \brief Helpers shared by unit tests of polynomial classes.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# pragma once
+
+# include <algorithm>
+# include <cmath>
+
+# include <gtest/gtest.h>
+
+# include "basic.h"
+
+
+// every expected root has a match in the results; the order is arbitrary
+inline void expect_roots(const simpoly::basic::CArry &expect,
+        const simpoly::basic::CArry &result, const double tol)
+{
+    ASSERT_EQ(expect.size(), result.size());
+
+    for(const auto &e: expect)
+    {
+        double best = 1e300;
+        for(const auto &r: result) best = std::min(best, std::abs(e - r));
+        ASSERT_NEAR(0.0, best, tol);
+    }
+}
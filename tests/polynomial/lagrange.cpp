@@ -0,0 +1,94 @@
+/**
+ * \file tests/polynomial/lagrange.cpp
+ * \brief Unit tests for the barycentric Lagrange basis.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# include <cmath>
+
+# include <gtest/gtest.h>
+
+# include "exceptions.h"
+# include "lagrange.h"
+
+using namespace simpoly;
+
+static const basic::DArry nodes({-1.0, -0.6, -0.1, 0.3, 0.75, 1.0});
+
+TEST(LagrangeBasis, Kronecker)
+{
+    poly::Lagrange L(nodes);
+
+    ASSERT_EQ(nodes.size(), L.size());
+
+    for(unsigned j=0; j<nodes.size(); ++j)
+        for(unsigned i=0; i<nodes.size(); ++i)
+            ASSERT_EQ((i==j)?1.0:0.0, L(j, nodes[i]));
+}
+
+TEST(LagrangeBasis, AgainstPolynomial)
+{
+    poly::Lagrange L(nodes);
+
+    for(unsigned j=0; j<nodes.size(); ++j)
+    {
+        poly::Polynomial p = L.to_polynomial(j);
+
+        ASSERT_EQ(poly::PolyType::LAGRANGE, p.type());
+        ASSERT_EQ(nodes.size()-1, p.degree());
+
+        for(double x=-1.2; x<1.2; x+=0.0173)
+            ASSERT_NEAR(p(x), L(j, x), 1e-12);
+    }
+}
+
+TEST(LagrangeBasis, BatchEvaluation)
+{
+    poly::Lagrange L(nodes);
+
+    basic::DArry x({-0.9, -0.6, 0.0, 0.2, 0.99});
+    basic::DArry v = L.evaluate(x);
+
+    for(unsigned k=0; k<x.size(); ++k)
+    {
+        double sum = 0.0;
+        basic::DArry all = L(x[k]);
+
+        for(unsigned j=0; j<L.size(); ++j)
+        {
+            ASSERT_NEAR(L(j, x[k]), v[k*L.size()+j], 1e-14);
+            ASSERT_EQ(all[j], v[k*L.size()+j]);
+            sum += v[k*L.size()+j];
+        }
+
+        ASSERT_NEAR(1.0, sum, 1e-14); // partition of unity
+    }
+}
+
+TEST(LagrangeBasis, AddNode)
+{
+    poly::Lagrange L1(nodes);
+    poly::Lagrange L2(basic::DArry(nodes.begin(), nodes.begin()+3));
+
+    for(unsigned i=3; i<nodes.size(); ++i) L2.add_node(nodes[i]);
+
+    for(unsigned j=0; j<nodes.size(); ++j)
+        for(double x=-1.0; x<1.0; x+=0.031)
+            ASSERT_NEAR(L1(j, x), L2(j, x), 1e-13);
+
+    ASSERT_THROW(L2.add_node(0.3), exceptions::PolynomialErrorGeneral);
+    ASSERT_THROW(poly::Lagrange({2.0, 2.0}), exceptions::PolynomialErrorGeneral);
+}
+
+TEST(LagrangeBasis, Interpolate)
+{
+    poly::Lagrange L(nodes);
+    poly::Polynomial p({0.3, -1.2, 0.5, 2.0, -0.7, 1.1});
+
+    basic::DArry values = p(nodes);
+
+    for(double x=-1.0; x<1.0; x+=0.047)
+        ASSERT_NEAR(p(x), L.interpolate(values, x), 1e-12);
+}
@@ -6,6 +6,9 @@
  * \date 2018-05-21
  */
 
+# include <algorithm>
+# include <cmath>
+
 # include <gtest/gtest.h>
 
 # include "exceptions.h"
@@ -84,3 +87,81 @@ TEST(LegendrePoly, LegendrePoly)
             ASSERT_NEAR(expect_roots[degree][i], r_roots[i], 1e-10);
     }
 }
+
+TEST(Legendre, RealRootsInInterval)
+{
+    for(unsigned n=1; n<20; ++n)
+    {
+        poly::Polynomial p = poly::Legendre(n);
+
+        basic::DArry expect = p.real_roots();
+        std::sort(expect.begin(), expect.end());
+
+        basic::DArry result = p.real_roots_in(-1.0, 1.0);
+
+        ASSERT_EQ(n, result.size());
+        for(unsigned i=0; i<n; ++i) ASSERT_NEAR(expect[i], result[i], 1e-10);
+    }
+}
+
+TEST(Legendre, RealRootsInIntervalHighDegree)
+{
+    const unsigned n = 40;
+    poly::Polynomial p = poly::Legendre(n);
+
+    // |P_n(+-1)| = 1 although the terms of P_40 reach 1e14
+    basic::DArry result = p.real_roots_in(-1.0, 1.0);
+    ASSERT_EQ(n, result.size());
+
+    for(unsigned k=0; k<n; ++k)
+    {
+        // Newton's method on the three-term recurrence from Tricomi's guess
+        double x = - std::cos(M_PI * (k + 0.75) / (n + 0.5));
+        for(unsigned iter=0; iter<100; ++iter)
+        {
+            double p0 = 1.0, p1 = x;
+            for(unsigned j=1; j<n; ++j)
+            {
+                const double p2 = ((2 * j + 1) * x * p1 - j * p0) / (j + 1);
+                p0 = p1; p1 = p2;
+            }
+            x -= p1 * (x * x - 1.0) / (n * (x * p1 - p0));
+        }
+
+        // the monomial coefficients are rounded, which moves roots near +-1
+        ASSERT_NEAR(x, result[k], 1e-4);
+    }
+}
+
+TEST(Legendre, RootsHighDegree)
+{
+    // the terms of P_n reach 1e14 at n = 40, so Horner's scheme can not
+    // resolve |p| near the roots; the iterations stop at the rounding level,
+    // and the approximate GCD may find spurious common factors
+    for(unsigned n=40; n<=60; n+=10)
+    {
+        poly::Polynomial p = poly::Legendre(n);
+
+        basic::CArry r1, r2, r3;
+        ASSERT_NO_THROW(r1 = basic::aberth(p.coef(), 1e-12));
+        ASSERT_NO_THROW(r2 = basic::yan_and_chieng_2006(p.coef(), 1e-10));
+        ASSERT_NO_THROW(r3 = p.roots());
+
+        ASSERT_EQ(n, r1.size());
+        ASSERT_EQ(n, r2.size());
+        ASSERT_EQ(n, r3.size());
+    }
+
+    // the roots are as accurate as the evaluation allows
+    basic::CArry r = basic::aberth(poly::Legendre(40).coef(), 1e-12);
+    basic::DArry expect = poly::Legendre(40).real_roots_in(-1.0, 1.0);
+
+    std::sort(r.begin(), r.end(),
+            [](basic::Cmplx x, basic::Cmplx y) { return x.real() < y.real(); });
+
+    for(unsigned i=0; i<40; ++i)
+    {
+        ASSERT_NEAR(expect[i], r[i].real(), 2e-4);
+        ASSERT_NEAR(0.0, r[i].imag(), 1e-5);
+    }
+}
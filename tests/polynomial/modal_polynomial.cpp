@@ -0,0 +1,107 @@
+/**
+ * \file tests/polynomial/modal_polynomial.cpp
+ * \brief Unit tests for polynomials in Jacobi bases.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# include <cmath>
+
+# include <gtest/gtest.h>
+
+# include "exceptions.h"
+# include "modal_polynomial.h"
+
+using namespace simpoly;
+
+static const basic::DArry c({0.3, -1.2, 0.5, 2.0, -0.7, 1.1, 0.25});
+static const basic::DArry x({-1.0, -0.75, -0.3, 0.0, 0.2, 0.65, 1.0});
+
+// sum_k c_k Jacobi(alpha, beta, k) in monomial coefficients
+static poly::Polynomial monomial(const basic::DArry &c, const double alpha, const double beta)
+{
+    poly::Polynomial p(basic::DArry(1, c[0]));
+    for(unsigned k=1; k<c.size(); ++k) p += c[k] * poly::Jacobi(alpha, beta, k);
+    return p;
+}
+
+
+TEST(ModalPolynomial, Evaluation)
+{
+    for(const auto &ab: std::vector<basic::DArry>({{0.0, 0.0}, {1.0, 0.0}, {-0.5, 0.5}, {2.0, 3.0}}))
+    {
+        poly::ModalPolynomial P(c, ab[0], ab[1]);
+        poly::Polynomial M = monomial(c, ab[0], ab[1]);
+
+        ASSERT_EQ(6u, P.degree());
+
+        const basic::DArry y = P(x);
+        for(unsigned i=0; i<x.size(); ++i)
+        {
+            ASSERT_NEAR(M(x[i]), P(x[i]), 1e-12 * std::max(1.0, std::abs(M(x[i]))));
+            ASSERT_EQ(P(x[i]), y[i]);
+        }
+    }
+
+    // P_k(1) = 1 and P_k(-1) = (-1)^k for Legendre polynomials of high degree
+    poly::ModalPolynomial L(basic::DArry(101, 1.0));
+    ASSERT_NEAR(101.0, L(1.0), 1e-11);
+    ASSERT_NEAR(1.0, L(-1.0), 1e-11);
+}
+
+
+TEST(ModalPolynomial, Conversions)
+{
+    for(const auto &ab: std::vector<basic::DArry>({{0.0, 0.0}, {1.0, 0.0}, {-0.5, 0.5}}))
+    {
+        poly::Polynomial M = monomial(c, ab[0], ab[1]);
+        ASSERT_EQ(M, poly::ModalPolynomial(c, ab[0], ab[1]).to_polynomial());
+
+        poly::ModalPolynomial P(M, ab[0], ab[1]);
+        ASSERT_EQ(c.size(), P.coef().size());
+        for(unsigned k=0; k<c.size(); ++k) ASSERT_NEAR(c[k], P.coef()[k], 1e-12);
+    }
+}
+
+
+TEST(ModalPolynomial, Calculus)
+{
+    for(const auto &ab: std::vector<basic::DArry>({{0.0, 0.0}, {1.0, 0.0}, {-0.5, 0.5}, {2.0, 3.0}}))
+    {
+        poly::ModalPolynomial D = poly::ModalPolynomial(c, ab[0], ab[1]).deriv();
+        poly::Polynomial M = monomial(c, ab[0], ab[1]).deriv();
+
+        ASSERT_EQ(5u, D.degree());
+        for(const auto &it: x) ASSERT_NEAR(M(it), D(it), 1e-11 * std::max(1.0, std::abs(M(it))));
+    }
+
+    ASSERT_EQ(0.0, poly::ModalPolynomial(basic::DArry(1, 2.0)).deriv()(0.3));
+}
+
+
+TEST(ModalPolynomial, Arithmetic)
+{
+    const basic::DArry d({-0.4, 0.9, 0.0, 1.5});
+
+    for(const auto &ab: std::vector<basic::DArry>({{0.0, 0.0}, {1.0, 0.0}, {2.0, 3.0}}))
+    {
+        poly::ModalPolynomial P(c, ab[0], ab[1]), Q(d, ab[0], ab[1]);
+        poly::Polynomial MP = monomial(c, ab[0], ab[1]), MQ = monomial(d, ab[0], ab[1]);
+
+        poly::ModalPolynomial S = P + Q, T = P - 2.0 * Q, U = P * Q, V = Q * P;
+        ASSERT_EQ(9u, U.degree());
+
+        for(const auto &it: x)
+        {
+            const double tol = 1e-11 * std::max(1.0, std::abs(MP(it) * MQ(it)));
+            ASSERT_NEAR(MP(it) + MQ(it), S(it), 1e-12);
+            ASSERT_NEAR(MP(it) - 2.0 * MQ(it), T(it), 1e-12);
+            ASSERT_NEAR(MP(it) * MQ(it), U(it), tol);
+            ASSERT_NEAR(MP(it) * MQ(it), V(it), tol);
+        }
+    }
+
+    ASSERT_THROW(poly::ModalPolynomial(c) + poly::ModalPolynomial(c, 1.0, 0.0),
+            exceptions::PolynomialErrorGeneral);
+}
@@ -445,3 +445,41 @@ TEST(PolynomialOp, operatorModulo)
 
     ASSERT_EQ(expect, p);
 }
+
+TEST(PolynomialOp, deflate)
+{
+    // the x = -1 end point of a left Radau polynomial
+    poly::Polynomial p = poly::Radau(5, poly::PolyType::LEFTRADAU);
+    basic::CArry all = p.roots();
+
+    p.deflate(basic::DArry({-1.0}));
+
+    ASSERT_EQ(4u, p.degree());
+    ASSERT_EQ(poly::PolyType::GENERAL, p.type());
+    ASSERT_EQ(4u, p.roots().size());
+
+    // the cached roots lost -1 and are not recomputed
+    for(const auto &it: p.roots())
+    {
+        ASSERT_GT(std::abs(it + 1.0), 1e-6);
+        ASSERT_NE(all.end(), std::find(all.begin(), all.end(), it));
+        ASSERT_NEAR(0.0, p(it.real()), 1e-12);
+    }
+
+    // complex pairs, with roots given by users
+    poly::Polynomial q(2.0, {0.5, -0.25}, {basic::Cmplx(1., 2.), basic::Cmplx(1., -2.)});
+    q.deflate(basic::CArry({basic::Cmplx(1., -2.), basic::Cmplx(0.5), basic::Cmplx(1., 2.)}));
+
+    ASSERT_EQ(1u, q.degree());
+    ASSERT_EQ(1u, q.n_real_roots());
+    ASSERT_EQ(0u, q.n_cmplx_roots());
+    ASSERT_DOUBLE_EQ(-0.25, q.real_roots()[0]);
+    ASSERT_NEAR(0.5, q.coef()[0], 1e-12);
+    ASSERT_NEAR(2.0, q.coef()[1], 1e-12);
+
+    // a root not in the cache drops the cache
+    poly::Polynomial r(1.0, basic::DArry({0.1, 0.2, 0.3}));
+    r.deflate(basic::DArry({0.2 + 1e-3}));
+    ASSERT_EQ(2u, r.degree());
+    ASSERT_EQ(2u, r.roots().size());
+}
@@ -0,0 +1,102 @@
+/**
+ * \file tests/polynomial/ppoly.cpp
+ * \brief Unit tests for piecewise polynomials.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# include <cmath>
+
+# include <gtest/gtest.h>
+
+# include "exceptions.h"
+# include "ppoly.h"
+
+using namespace simpoly;
+
+// one cubic per interval in x
+static std::vector<poly::Polynomial> pieces(const unsigned m)
+{
+    std::vector<poly::Polynomial> p;
+    for(unsigned i=0; i<m; ++i)
+        p.push_back(poly::Polynomial({0.1 * i, 1.0 - 0.01 * i, 0.5, (i % 3) + 1.0}));
+    return p;
+}
+
+// points in a scrambled order, including breakpoints and points outside
+static basic::DArry queries(const basic::DArry &b)
+{
+    basic::DArry x(b);
+    for(unsigned j=0; j<500; ++j)
+        x.push_back(b.front() + (b.back() - b.front()) * std::fmod(0.618034 * j * j, 1.0));
+    x.push_back(b.front() - 0.1);
+    x.push_back(b.back() + 0.1);
+    return x;
+}
+
+static void check(const basic::DArry &b)
+{
+    const unsigned m = b.size() - 1;
+    const std::vector<poly::Polynomial> p = pieces(m);
+
+    poly::PPoly P(b, p);
+    ASSERT_EQ(m, P.size());
+    ASSERT_EQ(3u, P.degree());
+
+    const basic::DArry x = queries(b), y = P(x);
+
+    for(unsigned q=0; q<x.size(); ++q)
+    {
+        // the reference: linear scan
+        unsigned i = 0;
+        while ((i + 1 < m) && (x[q] >= b[i+1])) ++i;
+
+        ASSERT_EQ(i, P.find(x[q]));
+        ASSERT_NEAR(p[i](x[q]), P(x[q]), 1e-12);
+        ASSERT_NEAR(P(x[q]), y[q], 1e-14);
+    }
+
+    // pieces in x survive the round trip through local coordinates
+    for(unsigned i=0; i<m; i+=7)
+        ASSERT_EQ(p[i], P.piece(i));
+
+    poly::PPoly D = P.deriv();
+    for(unsigned q=0; q<x.size(); q+=13)
+        ASSERT_NEAR(p[P.find(x[q])].deriv()(x[q]), D(x[q]), 1e-12);
+}
+
+
+TEST(PPoly, Uniform)
+{
+    basic::DArry b(201);
+    for(unsigned i=0; i<b.size(); ++i) b[i] = -1.0 + 0.01 * i;
+
+    ASSERT_TRUE(poly::PPoly(b, pieces(200)).uniform());
+    check(b);
+}
+
+
+TEST(PPoly, NonUniform)
+{
+    basic::DArry b(301);
+    for(unsigned i=0; i<b.size(); ++i) b[i] = std::pow(i / 300.0, 2) * 3.0 - 1.0;
+
+    ASSERT_FALSE(poly::PPoly(b, pieces(300)).uniform());
+    check(b);
+    check({0.0, 0.5});
+}
+
+
+TEST(PPoly, LocalCoefficients)
+{
+    // 1 + (x - b_i) on [0, 1) and 2 (x - b_i)^2 on [1, 3)
+    poly::PPoly P({0.0, 1.0, 3.0}, 2, {1.0, 1.0, 0.0, 0.0, 0.0, 2.0});
+
+    ASSERT_EQ(1.5, P(0.5));
+    ASSERT_EQ(2.0, P(2.0));
+    ASSERT_EQ(8.0, P(3.0));
+
+    ASSERT_THROW(poly::PPoly({0.0, 1.0, 3.0}, 2, basic::DArry(5)), exceptions::UnmatchedLength);
+    ASSERT_THROW(poly::PPoly({0.0, 1.0, 1.0}, 0, basic::DArry(2)), exceptions::PolynomialErrorGeneral);
+}
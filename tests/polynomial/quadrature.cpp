@@ -0,0 +1,201 @@
+/**
+ * \file tests/polynomial/quadrature.cpp
+ * \brief Unit tests for quadrature rules and the rule registry.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# include <cmath>
+# include <cstdint>
+# include <cstdio>
+# include <fstream>
+# include <thread>
+
+# include <gtest/gtest.h>
+
+# include "exceptions.h"
+# include "quadrature.h"
+
+using namespace simpoly;
+
+// integral of x^k over [-1, 1]
+static double exact_monomial(const unsigned k)
+{
+    return (k % 2 == 1) ? 0.0 : 2.0 / (k + 1.0);
+}
+
+// apply a rule to x^k
+static double apply_rule(const poly::QuadratureRule &rule, const unsigned k)
+{
+    double result = 0.0;
+    for(unsigned i=0; i<rule.size(); ++i)
+        result += rule.weights()[i] * std::pow(rule.nodes()[i], k);
+    return result;
+}
+
+TEST(Quadrature, GaussLegendre)
+{
+    for(unsigned n=1; n<13; ++n)
+    {
+        poly::QuadratureRule rule(poly::PolyType::LEGENDRE, n);
+
+        ASSERT_EQ(n, rule.size());
+        ASSERT_EQ(poly::PolyType::LEGENDRE, rule.type());
+
+        for(unsigned i=1; i<n; ++i)
+            ASSERT_LT(rule.nodes()[i-1], rule.nodes()[i]);
+
+        for(unsigned k=0; k<2*n; ++k)
+            ASSERT_NEAR(exact_monomial(k), apply_rule(rule, k), 1e-12);
+    }
+}
+
+TEST(Quadrature, GaussRadau)
+{
+    for(unsigned n=1; n<13; ++n)
+    {
+        poly::QuadratureRule left(poly::PolyType::LEFTRADAU, n);
+        poly::QuadratureRule right(poly::PolyType::RIGHTRADAU, n);
+
+        ASSERT_NEAR(-1.0, left.nodes()[0], 1e-12);
+        ASSERT_NEAR(1.0, right.nodes()[n-1], 1e-12);
+
+        for(unsigned k=0; k<2*n-1; ++k)
+        {
+            ASSERT_NEAR(exact_monomial(k), apply_rule(left, k), 1e-12);
+            ASSERT_NEAR(exact_monomial(k), apply_rule(right, k), 1e-12);
+        }
+    }
+}
+
+TEST(Quadrature, GaussJacobi)
+{
+    const double alpha = 1.0, beta = 0.5;
+
+    // integral of (1-x)^alpha (1+x)^beta over [-1, 1]
+    const double expect = std::pow(2.0, alpha+beta+1.0) *
+        std::tgamma(alpha+1.0) * std::tgamma(beta+1.0) /
+        std::tgamma(alpha+beta+2.0);
+
+    for(unsigned n=1; n<11; ++n)
+    {
+        poly::QuadratureRule rule(poly::PolyType::JACOBI, n, alpha, beta);
+
+        double sum = 0.0;
+        for(unsigned i=0; i<n; ++i) sum += rule.weights()[i];
+
+        ASSERT_NEAR(expect, sum, 1e-12);
+        ASSERT_EQ(alpha, rule.alpha());
+        ASSERT_EQ(beta, rule.beta());
+    }
+}
+
+TEST(Quadrature, NodePolynomial)
+{
+    poly::QuadratureRule rule(poly::PolyType::LEFTRADAU, 5);
+    poly::Polynomial p = poly::Radau(5, poly::PolyType::LEFTRADAU);
+    basic::DArry c = p.coef();
+
+    for(unsigned i=0; i<6; ++i) ASSERT_EQ(c[i], rule.coef()[i]);
+}
+
+TEST(Quadrature, CheckExceptions)
+{
+    ASSERT_THROW(poly::QuadratureRule(poly::PolyType::GENERAL, 3),
+            exceptions::IllegalType);
+    ASSERT_THROW(poly::QuadratureRule(poly::PolyType::LEGENDRE, 0),
+            exceptions::PolynomialErrorGeneral);
+}
+
+TEST(Quadrature, RegistrySharesRules)
+{
+    poly::RulePtr r1 = poly::quadrature_rule(poly::PolyType::LEGENDRE, 7);
+    poly::RulePtr r2 = poly::quadrature_rule(poly::PolyType::LEGENDRE, 7);
+    poly::RulePtr r3 = poly::quadrature_rule(poly::PolyType::LEGENDRE, 7, 1.0, 2.0);
+    poly::RulePtr r4 = poly::quadrature_rule(poly::PolyType::JACOBI, 7, 1.0, 2.0);
+    poly::RulePtr r5 = poly::quadrature_rule(poly::PolyType::JACOBI, 7, 1.0, 2.0);
+
+    ASSERT_EQ(r1.get(), r2.get());
+    ASSERT_EQ(r1.get(), r3.get()); // alpha & beta are ignored for Legendre
+    ASSERT_NE(r1.get(), r4.get());
+    ASSERT_EQ(r4.get(), r5.get());
+}
+
+TEST(Quadrature, RegistryConcurrentReaders)
+{
+    poly::prewarm_quadrature_rules(poly::PolyType::RIGHTRADAU, {2, 4, 6, 8});
+
+    std::vector<const poly::QuadratureRule*> ptrs(8*9, nullptr);
+    std::vector<std::thread> threads;
+
+    for(unsigned t=0; t<8; ++t)
+        threads.push_back(std::thread([t, &ptrs]() {
+            for(unsigned n=1; n<10; ++n)
+                ptrs[t*9+n-1] = poly::quadrature_rule(
+                        poly::PolyType::RIGHTRADAU, n).get();
+        }));
+
+    for(auto &th: threads) th.join();
+
+    for(unsigned t=1; t<8; ++t)
+        for(unsigned n=0; n<9; ++n)
+            ASSERT_EQ(ptrs[n], ptrs[t*9+n]);
+}
+
+TEST(Quadrature, CacheFileRoundTrip)
+{
+    const std::string path = testing::TempDir() + "simpoly_quadrature.bin";
+
+    // rules built outside the registry so that loading them registers them
+    std::vector<poly::RulePtr> rules;
+    for(unsigned n=1; n<8; ++n)
+        rules.push_back(std::make_shared<poly::QuadratureRule>(
+                    poly::PolyType::JACOBI, n, 0.25, 0.75));
+
+    poly::save_quadrature_rules(path, rules);
+
+    ASSERT_EQ(7u, poly::load_quadrature_rules(path));
+    ASSERT_EQ(0u, poly::load_quadrature_rules(path)); // already registered
+
+    for(unsigned n=1; n<8; ++n)
+    {
+        poly::RulePtr r = poly::quadrature_rule(poly::PolyType::JACOBI, n, 0.25, 0.75);
+
+        ASSERT_EQ(n, r->size());
+        ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(r->coef()) % 64);
+
+        for(unsigned i=0; i<=n; ++i) ASSERT_EQ(rules[n-1]->coef()[i], r->coef()[i]);
+
+        for(unsigned i=0; i<n; ++i)
+        {
+            ASSERT_EQ(rules[n-1]->nodes()[i], r->nodes()[i]);
+            ASSERT_EQ(rules[n-1]->weights()[i], r->weights()[i]);
+        }
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST(Quadrature, CacheFileValidation)
+{
+    const std::string path = testing::TempDir() + "simpoly_quadrature_bad.bin";
+
+    ASSERT_EQ(0u, poly::load_quadrature_rules(path)); // missing file
+
+    std::vector<poly::RulePtr> rules;
+    rules.push_back(std::make_shared<poly::QuadratureRule>(
+                poly::PolyType::JACOBI, 3, 0.5, 0.5));
+    poly::save_quadrature_rules(path, rules);
+
+    // flip one byte in the payload; the hash no longer matches
+    {
+        std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(100);
+        f.put(char(0x7f));
+    }
+
+    ASSERT_EQ(0u, poly::load_quadrature_rules(path));
+
+    std::remove(path.c_str());
+}
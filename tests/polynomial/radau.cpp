@@ -6,6 +6,9 @@
  * \date 2018-05-21
  */
 
+# include <algorithm>
+# include <iomanip>
+
 # include <gtest/gtest.h>
 
 # include "exceptions.h"
@@ -89,6 +89,79 @@ TEST(PolynomialReset, type)
     run(c, rr, cr, allroots, p, poly::LAGRANGE, false, 4, 2, 2);
 }
 
+TEST(PolynomialReset, RootMethod)
+{
+    basic::DArry c({-5., 4., 4., -4., 1.});
+
+    basic::DArry rr({-1.0, 1.0});
+
+    basic::CArry cr({basic::Cmplx(2., -1.), basic::Cmplx(2., 1.)});
+
+    basic::CArry allroots({ 1.0, -1.0, basic::Cmplx(2.0, -1.0), basic::Cmplx(2.0, 1.0) });
+
+    poly::Polynomial p(c);
+    ASSERT_EQ(basic::RootMethod::ABERTH, p.root_method());
+
+    p.set(basic::RootMethod::COMPANION);
+    ASSERT_EQ(basic::RootMethod::COMPANION, p.root_method());
+
+    run(c, rr, cr, allroots, p, poly::GENERAL, false, 4, 2, 2);
+}
+
+TEST(PolynomialReset, Accuracy)
+{
+    basic::DArry c({-5., 4., 4., -4., 1.});
+
+    basic::DArry rr({-1.0, 1.0});
+
+    basic::CArry cr({basic::Cmplx(2., -1.), basic::Cmplx(2., 1.)});
+
+    basic::CArry allroots({ 1.0, -1.0, basic::Cmplx(2.0, -1.0), basic::Cmplx(2.0, 1.0) });
+
+    poly::Polynomial p(c);
+    ASSERT_EQ(basic::Accuracy::STANDARD, p.accuracy());
+
+    p.set(basic::Accuracy::COMPENSATED);
+    ASSERT_EQ(basic::Accuracy::COMPENSATED, p.accuracy());
+    ASSERT_EQ(basic::evaluate_compensated(c, 0.3), p(0.3));
+
+    run(c, rr, cr, allroots, p, poly::GENERAL, false, 4, 2, 2);
+}
+
+TEST(PolynomialReset, RootStats)
+{
+    basic::DArry c({
+            -0.1195107918695455,  0.8447947406345584, -0.6030868103450979,
+            -0.9766533913297424, -0.2677767116634977,  0.3804660521221173,
+            -0.4716581713021364, -0.8085712194756074,  0.1556975750852925 });
+
+    poly::Polynomial p(c);
+    p.roots();
+
+    const basic::RootStats &s = p.root_stats();
+
+    if (! basic::root_stats_enabled())
+    {
+        ASSERT_EQ(0u, s.evaluations);
+        ASSERT_EQ(0u, s.iterations);
+        return;
+    }
+
+    // the simple-root engine and the refinement both ran
+    ASSERT_GT(s.evaluations, 0u);
+    ASSERT_GT(s.iterations, 0u);
+    ASSERT_GT(s.gcd_steps, 0u);
+    ASSERT_EQ(c.size() - 1, s.sweeps.size());
+    for(const auto &it: s.sweeps) ASSERT_GT(it, 0u);
+    ASSERT_GT(s.timings.total(), 0.0);
+    ASSERT_FALSE(s.near_limit());
+
+    // found roots are reused, so statistics stay
+    const unsigned long evaluations = s.evaluations;
+    p.roots();
+    ASSERT_EQ(evaluations, p.root_stats().evaluations);
+}
+
 TEST(PolynomialReset, Coefficient1)
 {
     poly::Polynomial p(1.0, {1.0, -1.0}, {basic::Cmplx(2., 1.), basic::Cmplx(2., -1.)});
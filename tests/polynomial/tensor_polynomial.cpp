@@ -0,0 +1,123 @@
+/**
+ * \file tests/polynomial/tensor_polynomial.cpp
+ * \brief Unit tests for tensor-product polynomials.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# include <gtest/gtest.h>
+
+# include "exceptions.h"
+# include "tensor_polynomial.h"
+
+using namespace simpoly;
+
+static const basic::DArry x({-1.0, -0.6, 0.1, 0.5, 0.9}), y({-0.8, 0.0, 0.7, 1.0}), z({-0.3, 0.2, 0.8});
+
+// Legendre polynomials of degree 0 to n-1
+static std::vector<poly::Polynomial> modal(const unsigned n)
+{
+    std::vector<poly::Polynomial> b;
+    for(unsigned i=0; i<n; ++i) b.push_back(poly::Legendre(i));
+    return b;
+}
+
+// pseudo-random coefficients
+static basic::DArry coefficients(const unsigned n)
+{
+    basic::DArry c(n);
+    for(unsigned i=0; i<n; ++i) c[i] = ((i * 37 + 11) % 19) / 9.5 - 1.0;
+    return c;
+}
+
+
+TEST(TensorPolynomial, Product)
+{
+    const poly::Polynomial X({0.5, -1.0, 2.0}), Y({1.0, 0.3}), Z({-0.2, 0.0, 0.0, 1.0});
+
+    poly::TensorPolynomial P(X, Y), Q(X, Y, Z);
+    ASSERT_EQ(2u, P.dim());
+    ASSERT_EQ(3u, Q.dim());
+
+    const basic::DArry u = Q.evaluate(x, y, z);
+
+    for(unsigned r=0; r<z.size(); ++r)
+        for(unsigned q=0; q<y.size(); ++q)
+            for(unsigned p=0; p<x.size(); ++p)
+            {
+                ASSERT_NEAR(X(x[p]) * Y(y[q]) * Z(z[r]), u[p + x.size() * (q + y.size() * r)], 1e-14);
+                ASSERT_NEAR(X(x[p]) * Y(y[q]), P(x[p], y[q]), 1e-14);
+            }
+
+    ASSERT_THROW(P.evaluate(x, y, z), exceptions::UnmatchedLength);
+    ASSERT_THROW(poly::TensorPolynomial(modal(3), modal(3), basic::DArry(8)), exceptions::UnmatchedLength);
+}
+
+
+TEST(TensorPolynomial, Modal2D)
+{
+    const std::vector<poly::Polynomial> X = modal(5), Y = modal(4);
+    const basic::DArry c = coefficients(20);
+
+    poly::TensorPolynomial P(X, Y, c);
+
+    basic::DArry u, ux, uy;
+    P.gradient(x, y, u, ux, uy);
+
+    for(unsigned q=0; q<y.size(); ++q)
+        for(unsigned p=0; p<x.size(); ++p)
+        {
+            double v = 0.0, vx = 0.0, vy = 0.0;
+            for(unsigned j=0; j<4; ++j)
+                for(unsigned i=0; i<5; ++i)
+                {
+                    v += c[i+5*j] * X[i](x[p]) * Y[j](y[q]);
+                    vx += c[i+5*j] * X[i].deriv()(x[p]) * Y[j](y[q]);
+                    vy += c[i+5*j] * X[i](x[p]) * Y[j].deriv()(y[q]);
+                }
+
+            const unsigned n = p + x.size() * q;
+            ASSERT_NEAR(v, u[n], 1e-13);
+            ASSERT_NEAR(vx, ux[n], 1e-12);
+            ASSERT_NEAR(vy, uy[n], 1e-12);
+            ASSERT_NEAR(v, P(x[p], y[q]), 1e-13);
+        }
+}
+
+
+TEST(TensorPolynomial, Modal3D)
+{
+    const std::vector<poly::Polynomial> X = modal(6), Y = modal(5), Z = modal(4);
+    const basic::DArry c = coefficients(120);
+
+    poly::TensorPolynomial P(X, Y, Z, c);
+
+    basic::DArry u, ux, uy, uz;
+    P.gradient(x, y, z, u, ux, uy, uz);
+    ASSERT_EQ(u, P.evaluate(x, y, z));
+
+    for(unsigned r=0; r<z.size(); ++r)
+        for(unsigned q=0; q<y.size(); ++q)
+            for(unsigned p=0; p<x.size(); ++p)
+            {
+                double v = 0.0, vx = 0.0, vy = 0.0, vz = 0.0;
+                for(unsigned k=0; k<4; ++k)
+                    for(unsigned j=0; j<5; ++j)
+                        for(unsigned i=0; i<6; ++i)
+                        {
+                            const double a = c[i+6*(j+5*k)];
+                            v += a * X[i](x[p]) * Y[j](y[q]) * Z[k](z[r]);
+                            vx += a * X[i].deriv()(x[p]) * Y[j](y[q]) * Z[k](z[r]);
+                            vy += a * X[i](x[p]) * Y[j].deriv()(y[q]) * Z[k](z[r]);
+                            vz += a * X[i](x[p]) * Y[j](y[q]) * Z[k].deriv()(z[r]);
+                        }
+
+                const unsigned n = p + x.size() * (q + y.size() * r);
+                ASSERT_NEAR(v, u[n], 1e-12);
+                ASSERT_NEAR(vx, ux[n], 1e-11);
+                ASSERT_NEAR(vy, uy[n], 1e-11);
+                ASSERT_NEAR(vz, uz[n], 1e-11);
+                ASSERT_NEAR(v, P(x[p], y[q], z[r]), 1e-12);
+            }
+}
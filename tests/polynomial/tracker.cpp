@@ -0,0 +1,128 @@
+/**
+ * \file tests/polynomial/tracker.cpp
+ * \brief Unit tests for warm-started root tracking.
+ * \author Pi-Yueh Chuang
+ * \version beta
+ * \date 2026-10-18
+ */
+
+# include <algorithm>
+# include <cmath>
+
+# include <gtest/gtest.h>
+
+# include "tracker.h"
+
+# include "helpers.h"
+
+using namespace simpoly;
+
+// coefficients of prod (x - r_i) * prod ((x - a_j)^2 + b_j^2)
+static basic::DArry from_roots(const basic::DArry &real, const basic::CArry &pairs)
+{
+    basic::DArry c({1.0});
+
+    auto multiply = [&c](const basic::DArry &f) {
+        basic::DArry r(c.size() + f.size() - 1, 0.0);
+        for(unsigned i=0; i<c.size(); ++i)
+            for(unsigned j=0; j<f.size(); ++j) r[i+j] += c[i] * f[j];
+        c = r;
+    };
+
+    for(const auto &r: real) multiply({-r, 1.0});
+    for(const auto &z: pairs) multiply({std::norm(z), -2.0 * z.real(), 1.0});
+
+    return c;
+}
+
+
+TEST(RootTracker, SimpleRoots)
+{
+    poly::RootTracker T;
+
+    for(unsigned step=0; step<50; ++step)
+    {
+        const double t = 0.002 * step;
+        const basic::DArry real({-0.9 + t, -0.2 + 0.5 * t, 0.4 - t, 1.3 + t});
+        const basic::CArry pairs({{0.1 + t, 0.8 - t}, {-0.5, 0.3 + t}});
+
+        T.update(from_roots(real, pairs));
+
+        ASSERT_EQ(step == 0, T.rebuilt());
+        if (step > 0) { ASSERT_LE(T.sweeps(), 4u); }
+
+        basic::CArry expect;
+        for(const auto &r: real) expect.push_back(r);
+        for(const auto &z: pairs) { expect.push_back(z); expect.push_back(std::conj(z)); }
+
+        expect_roots(expect, T.roots(), 1e-10);
+    }
+}
+
+
+TEST(RootTracker, MultipleRoots)
+{
+    poly::RootTracker T;
+
+    // a double root and a triple root drift together with simple roots
+    for(unsigned step=0; step<20; ++step)
+    {
+        const double t = 0.003 * step;
+        const basic::DArry real({0.5 + t, 0.5 + t, -0.7, -0.7, -0.7, 1.1 - t});
+        const basic::CArry pairs({{0.2, 0.9 + t}});
+
+        T.update(from_roots(real, pairs));
+
+        ASSERT_EQ(step == 0, T.rebuilt());
+        if (step > 0) { ASSERT_LE(T.sweeps(), 6u); }
+
+        ASSERT_EQ(5u, T.distinct_roots().size());
+        ASSERT_EQ(3u, *std::max_element(T.multiplicities().begin(), T.multiplicities().end()));
+
+        basic::CArry expect({0.5 + t, -0.7, 1.1 - t, {0.2, 0.9 + t}, {0.2, -0.9 - t}});
+        expect_roots(expect, T.distinct_roots(), 1e-4);
+    }
+}
+
+
+TEST(RootTracker, StructureChange)
+{
+    poly::RootTracker T;
+    const basic::CArry pairs({{0.3, 0.6}});
+
+    // a double root splits into two simple roots
+    T.update(from_roots({0.5, 0.5, -0.8, 1.2}, pairs));
+    ASSERT_EQ(5u, T.distinct_roots().size());
+
+    T.update(from_roots({0.45, 0.55, -0.8, 1.2}, pairs));
+    ASSERT_TRUE(T.rebuilt());
+    ASSERT_EQ(6u, T.distinct_roots().size());
+    expect_roots({0.45, 0.55, -0.8, 1.2, {0.3, 0.6}, {0.3, -0.6}}, T.roots(), 1e-10);
+
+    // the two simple roots merge again
+    T.update(from_roots({0.5, 0.5, -0.8, 1.2}, pairs));
+    ASSERT_TRUE(T.rebuilt());
+    ASSERT_EQ(5u, T.distinct_roots().size());
+
+    // a change of degree starts cold
+    T.update(from_roots({0.5, -0.8, 1.2}, pairs));
+    ASSERT_TRUE(T.rebuilt());
+    ASSERT_EQ(5u, T.roots().size());
+
+    T.reset();
+    T.update(from_roots({0.5, -0.8, 1.2}, pairs));
+    ASSERT_TRUE(T.rebuilt());
+}
+
+
+TEST(RootTracker, PolynomialInput)
+{
+    poly::RootTracker T;
+    const basic::DArry c = from_roots({-0.6, 0.1, 0.7, 0.9, 1.4}, {{0.0, 1.0}});
+
+    T.update(poly::Polynomial(c));
+    T.update(poly::Polynomial(c));
+
+    ASSERT_FALSE(T.rebuilt());
+    ASSERT_EQ(1u, T.sweeps());
+}